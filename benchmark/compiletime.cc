@@ -0,0 +1,21 @@
+/*
+ * A translation unit using the tween types compiled by tweeny-instantiations, as a typical user of tweeny would. It is
+ * only compiled by the tweeny-compile-benchmark target, which measures how long that takes.
+ */
+
+#include "tweeny.h"
+
+float animate() {
+    auto fade = tweeny::from(0.0f).to(1.0f).during(100).via(tweeny::easing::cubicOut);
+    auto slide = tweeny::from(0.0f, 0.0f).to(1.0f, 2.0f).during(100).via("bounceOut");
+    auto color = tweeny::from(0.0f, 0.0f, 0.0f, 0.0f).to(1.0f, 1.0f, 1.0f, 1.0f).during(100);
+    auto frame = tweeny::from(0).to(10).during(50).repeat(2);
+    tweeny::collection<float, float, float> positions;
+    positions.add(tweeny::from(0.0f, 0.0f, 0.0f).to(1.0f, 1.0f, 1.0f).during(10));
+    positions.step(5);
+    fade.step(10);
+    slide.step(0.5f);
+    color.seek(20u);
+    frame.step(5);
+    return fade.peek() + std::get<0>(slide.peek()) + std::get<3>(color.peek()) + frame.peek() + fade.velocity();
+}
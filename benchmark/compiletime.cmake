@@ -0,0 +1,37 @@
+# Measures how long compiletime.cc takes to compile with and without the extern templates declared for the
+# tweeny-instantiations library. Run it through the tweeny-compile-benchmark target.
+#
+# Expects COMPILER, INCLUDE_DIR and SOURCE to be defined, and optionally FLAGS and REPEAT.
+
+if (CMAKE_VERSION VERSION_LESS 3.23)
+    message(FATAL_ERROR "The compile time benchmark needs CMake 3.23 or newer to measure time")
+endif()
+
+if (NOT REPEAT)
+    set(REPEAT 5)
+endif()
+string(STRIP "${FLAGS}" FLAGS)
+set(flagsText "${FLAGS}")
+separate_arguments(FLAGS)
+
+function(measure result)
+    string(TIMESTAMP start "%s%f")
+    foreach(i RANGE 1 ${REPEAT})
+        execute_process(
+            COMMAND ${COMPILER} ${FLAGS} ${ARGN} -I${INCLUDE_DIR} -c ${SOURCE} -o compiletime.o
+            RESULT_VARIABLE failed)
+        if (failed)
+            message(FATAL_ERROR "Could not compile ${SOURCE}")
+        endif()
+    endforeach()
+    string(TIMESTAMP end "%s%f")
+    math(EXPR elapsed "(${end} - ${start}) / (${REPEAT} * 1000)")
+    set(${result} ${elapsed} PARENT_SCOPE)
+endfunction()
+
+measure(header)
+measure(extern -DTWEENY_EXTERN_TEMPLATES)
+math(EXPR saved "100 - (100 * ${extern}) / ${header}")
+message("Flags:            ${flagsText}")
+message("Header only:      ${header} ms per translation unit")
+message("Extern templates: ${extern} ms per translation unit (${saved}% less)")
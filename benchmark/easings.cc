@@ -0,0 +1,127 @@
+/*
+ * Compares every bundled easing, and the approximate ones in easing::fast, against a reference computed in double
+ * precision over densely sampled positions. Prints the maximum and mean absolute error, for a tween from 0 to 1, and
+ * how long each easing takes to evaluate. Build it in release mode, through the tweeny-easing-benchmark target.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "tweeny.h"
+
+using tweeny::easing;
+
+namespace {
+    const int samples = 1000000;
+    const int repeats = 5;
+
+    /* Math functions in double precision, used by the reference easings */
+    struct referencemath {
+        static double sin(double x) { return std::sin(x); }
+        static double cos(double x) { return std::cos(x); }
+        static double exp2(double x) { return std::pow(2.0, x); }
+        static double sqrt(double x) { return std::sqrt(x); }
+    };
+
+    /* Wraps an easing that uses math functions, so that its reference uses referencemath */
+    template<typename EasingT>
+    struct reference {
+        static double run(float position) { return EasingT::template run<double, referencemath>(position, 0.0, 1.0); }
+    };
+
+    /* Wraps an easing with no math functions, whose reference only needs to compute in double */
+    template<typename EasingT>
+    struct plain {
+        static double run(float position) { return EasingT::template run<double>(position, 0.0, 1.0); }
+    };
+
+    struct result {
+        double max = 0, mean = 0, nanoseconds = 0;
+    };
+
+    template<typename EasingT, typename ReferenceT>
+    result measure(const std::vector<float> & positions) {
+        result r;
+        for (float p : positions) {
+            double error = std::fabs(EasingT::template run<float>(p, 0.0f, 1.0f) - ReferenceT::run(p));
+            r.max = std::max(r.max, error);
+            r.mean += error;
+        }
+        r.mean /= positions.size();
+
+        /* easings are timed through the same table of functions that tweens call */
+        const tweeny::detail::curve<float> & curve = tweeny::detail::curveof<EasingT, float>::value;
+        r.nanoseconds = 1e9;
+        for (int i = 0; i < repeats; ++i) { // keeps the fastest run, the least disturbed by everything else
+            volatile float sink = 0;
+            float sum = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (float p : positions) sum += curve.run(p, 0.0f, 1.0f);
+            auto end = std::chrono::steady_clock::now();
+            sink = sum;
+            (void) sink;
+            r.nanoseconds = std::min(r.nanoseconds, std::chrono::duration<double, std::nano>(end - start).count() / positions.size());
+        }
+        return r;
+    }
+
+    void print(const char * name, result precise) {
+        printf("%-18s %10.2e %10.2e %8.2f\n", name, precise.max, precise.mean, precise.nanoseconds);
+    }
+
+    void print(const char * name, result precise, result fast) {
+        printf("%-18s %10.2e %10.2e %8.2f %10.2e %10.2e %8.2f %7.2fx\n", name, precise.max, precise.mean,
+               precise.nanoseconds, fast.max, fast.mean, fast.nanoseconds, precise.nanoseconds / fast.nanoseconds);
+    }
+}
+
+#define PLAIN(name) print(#name, measure<easing::name ## Easing, plain<easing::name ## Easing>>(positions))
+#define MATH(name) print(#name, measure<easing::name ## Easing, reference<easing::name ## Easing>>(positions))
+#define FAST(name) print(#name, measure<easing::name ## Easing, reference<easing::name ## Easing>>(positions), \
+    measure<tweeny::detail::approximated<easing::name ## Easing>, reference<easing::name ## Easing>>(positions))
+
+int main() {
+    std::vector<float> positions(samples);
+    for (int i = 0; i < samples; ++i) positions[i] = static_cast<float>(i) / (samples - 1);
+
+#ifdef TWEENY_FAST_MATH
+    puts("Built with TWEENY_FAST_MATH: bundled easings are the approximate ones\n");
+#endif
+    printf("%-18s %10s %10s %8s %10s %10s %8s %8s\n", "easing", "max", "mean", "ns", "fast max", "fast mean", "fast ns",
+           "speedup");
+    PLAIN(linear);
+    PLAIN(quadraticIn);
+    PLAIN(quadraticOut);
+    PLAIN(quadraticInOut);
+    PLAIN(cubicIn);
+    PLAIN(cubicOut);
+    PLAIN(cubicInOut);
+    PLAIN(quarticIn);
+    PLAIN(quarticOut);
+    PLAIN(quarticInOut);
+    PLAIN(quinticIn);
+    PLAIN(quinticOut);
+    PLAIN(quinticInOut);
+    FAST(sinusoidalIn);
+    FAST(sinusoidalOut);
+    FAST(sinusoidalInOut);
+    FAST(exponentialIn);
+    FAST(exponentialOut);
+    FAST(exponentialInOut);
+    MATH(circularIn);
+    MATH(circularOut);
+    MATH(circularInOut);
+    PLAIN(bounceIn);
+    PLAIN(bounceOut);
+    PLAIN(bounceInOut);
+    FAST(elasticIn);
+    FAST(elasticOut);
+    FAST(elasticInOut);
+    PLAIN(backIn);
+    PLAIN(backOut);
+    PLAIN(backInOut);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * Compares tweeny::pool with what it replaces: a std::vector of tweens along with the id of each, where removing a
+ * tween means finding its id and erasing it. Both go through the same churn, removing and adding a share of their
+ * tweens every frame, then stepping them all. Prints how long a frame takes, and how long stepping alone takes after
+ * the churn. Build it in release mode, through the tweeny-pool-benchmark target.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "tweeny.h"
+
+namespace {
+    const int tweens = 10000;
+    const int churn = 100; // tweens removed and added every frame
+    const int frames = 200;
+
+    typedef tweeny::tween<float, float> motion;
+
+    motion make(int i) {
+        float f = static_cast<float>(i % 100);
+        return tweeny::from(f, -f).to(-f, f).during(1000).via(tweeny::easing::cubicInOut).repeat(-1).yoyo();
+    }
+
+    /* Ids of live tweens, picked at random for removal like game objects being destroyed */
+    template<typename Id>
+    size_t pick(std::vector<Id> & live, std::mt19937 & random) {
+        return std::uniform_int_distribution<size_t>(0, live.size() - 1)(random);
+    }
+
+    double since(std::chrono::steady_clock::time_point start, int count) {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / count;
+    }
+
+    void vector() {
+        std::mt19937 random(1);
+        std::vector<motion> all;
+        std::vector<int> ids;
+        std::vector<int> live;
+        int next = 0;
+        for (; next < tweens; ++next) { all.push_back(make(next)); ids.push_back(next); live.push_back(next); }
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) {
+            for (int c = 0; c < churn; ++c) {
+                size_t k = pick(live, random);
+                size_t i = static_cast<size_t>(std::find(ids.begin(), ids.end(), live[k]) - ids.begin());
+                all.erase(all.begin() + static_cast<std::ptrdiff_t>(i));
+                ids.erase(ids.begin() + static_cast<std::ptrdiff_t>(i));
+                live[k] = next;
+                all.push_back(make(next));
+                ids.push_back(next++);
+            }
+            for (motion & t : all) t.step(16);
+        }
+        double frame = since(start, frames);
+
+        start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) for (motion & t : all) t.step(16);
+        printf("%-40s %8.1f us per frame, %8.1f us stepping\n", "std::vector, find and erase", frame, since(start, frames));
+    }
+
+    void pool() {
+        std::mt19937 random(1);
+        tweeny::pool<float, float> all;
+        std::vector<tweeny::handle> live;
+        int next = 0;
+        for (; next < tweens; ++next) live.push_back(all.add(make(next)));
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) {
+            for (int c = 0; c < churn; ++c) {
+                size_t k = pick(live, random);
+                all.remove(live[k]);
+                live[k] = all.add(make(next++));
+            }
+            all.step(16);
+        }
+        double frame = since(start, frames);
+
+        start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) all.step(16);
+        printf("%-40s %8.1f us per frame, %8.1f us stepping\n", "tweeny::pool, handles", frame, since(start, frames));
+    }
+}
+
+int main() {
+    printf("%d tweens, %d removed and added per frame\n", tweens, churn);
+    vector();
+    pool();
+    return 0;
+}
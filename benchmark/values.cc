@@ -0,0 +1,80 @@
+/*
+ * Measures how tweeny handles heavy value types, with a 64 bytes 4x4 matrix that counts its copies. Prints how many
+ * times a matrix is copied to build, step and grow tweens, and how long stepping takes. Build it in release mode,
+ * through the tweeny-value-benchmark target.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "tweeny.h"
+
+namespace {
+    const int tweens = 10000;
+    const int frames = 100;
+    const int repeats = 5;
+
+    unsigned long copies = 0;
+
+    /* A 4x4 matrix of floats, with the arithmetic operators tweens need */
+    struct matrix {
+        float m[16];
+
+        matrix() : m() { }
+        explicit matrix(float f) { std::fill(m, m + 16, f); }
+        matrix(const matrix & other) { std::copy(other.m, other.m + 16, m); ++copies; }
+        matrix & operator=(const matrix & other) { std::copy(other.m, other.m + 16, m); ++copies; return *this; }
+        matrix(matrix && other) noexcept { std::copy(other.m, other.m + 16, m); }
+        matrix & operator=(matrix && other) noexcept { std::copy(other.m, other.m + 16, m); return *this; }
+
+        matrix operator+(const matrix & o) const { matrix r; for (int i = 0; i < 16; ++i) r.m[i] = m[i] + o.m[i]; return r; }
+        matrix operator-() const { return *this * -1.0f; }
+        matrix operator-(const matrix & o) const { matrix r; for (int i = 0; i < 16; ++i) r.m[i] = m[i] - o.m[i]; return r; }
+        matrix operator*(const matrix & o) const { matrix r; for (int i = 0; i < 16; ++i) r.m[i] = m[i] * o.m[i]; return r; }
+        matrix operator*(float f) const { matrix r; for (int i = 0; i < 16; ++i) r.m[i] = m[i] * f; return r; }
+        matrix operator/(float f) const { return *this * (1 / f); }
+    };
+
+    matrix operator*(float f, const matrix & m) { return m * f; }
+
+    static_assert(sizeof(matrix) == 64, "The benchmark is about 64 bytes values");
+
+    tweeny::tween<matrix> make(float f) {
+        return tweeny::from(matrix(f)).to(matrix(f + 1)).during(500).via(tweeny::easing::quadraticInOut)
+                                      .to(matrix(f)).during(500).repeat(-1);
+    }
+}
+
+int main() {
+    static_assert(std::is_nothrow_move_constructible<tweeny::tween<matrix>>::value, "Tweens should move cheaply");
+
+    copies = 0;
+    auto single = make(0);
+    printf("%-40s %8lu\n", "copies to build a tween", copies);
+
+    copies = 0;
+    for (int i = 0; i < frames; ++i) single.step(16);
+    printf("%-40s %8.2f\n", "copies per step", static_cast<double>(copies) / frames);
+
+    std::vector<tweeny::tween<matrix>> built;
+    built.reserve(tweens);
+    for (int i = 0; i < tweens; ++i) built.push_back(make(static_cast<float>(i)));
+    copies = 0;
+    std::vector<tweeny::tween<matrix>> grown;
+    for (auto & t : built) grown.push_back(std::move(t));
+    printf("%-40s %8.2f\n", "copies per tween, growing a vector", static_cast<double>(copies) / tweens);
+
+    tweeny::collection<matrix> all;
+    for (int i = 0; i < tweens; ++i) all.add(make(static_cast<float>(i)));
+    double nanoseconds = 1e9;
+    for (int r = 0; r < repeats; ++r) { // keeps the fastest run, the least disturbed by everything else
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frames; ++i) all.step(16);
+        auto end = std::chrono::steady_clock::now();
+        nanoseconds = std::min(nanoseconds, std::chrono::duration<double, std::nano>(end - start).count() / (frames * tweens));
+    }
+    printf("%-40s %8.2f\n", "nanoseconds per tween step", nanoseconds);
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * This file declares the awaitable objects returned by tween::finished and tween::reaches, and the tweeny::task
+ * coroutine type. Awaiting them requires C++20 coroutines, but this file can be included by C++11 code: everything
+ * that depends on <coroutine> is only declared when the compiler supports it.
+ */
+
+#ifndef TWEENY_AWAITER_H
+#define TWEENY_AWAITER_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "tweenpoint.h"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <coroutine>
+#include <exception>
+#define TWEENY_HAS_COROUTINES 1
+#endif
+
+namespace tweeny {
+    namespace detail {
+        /* A suspended coroutine waiting for a tween to reach a time point */
+        struct waiter {
+            static constexpr uint32_t finished = std::numeric_limits<uint32_t>::max(); // waits for tween::isFinished
+            uint32_t time;
+            void * handle; // coroutine handle address
+            void (*resume)(void *);
+            void (*destroy)(void *);
+
+            bool operator<(const waiter & other) const { return time < other.time; }
+        };
+
+        /* Waiters are bound to one tween object, so copies of a tween start with an empty list, while moves take them.
+         * Coroutines still waiting on a tween that is destroyed or moved over can never be resumed, so they are
+         * destroyed with it */
+        struct waitlist : std::vector<waiter> {
+            waitlist() = default;
+            waitlist(const waitlist &) : std::vector<waiter>() { }
+            waitlist(waitlist &&) noexcept = default;
+            waitlist & operator=(const waitlist &) { return *this; }
+
+            waitlist & operator=(waitlist && other) noexcept {
+                if (this == &other) return *this;
+                abandon();
+                std::vector<waiter>::operator=(std::move(other));
+                other.clear();
+                return *this;
+            }
+
+            ~waitlist() { abandon(); }
+
+            /* Destroys the waiting coroutines. They are taken out first, as their frames may own tweens too */
+            void abandon() {
+                std::vector<waiter> pending;
+                pending.swap(*this);
+                for (auto & w : pending) w.destroy(w.handle);
+            }
+        };
+
+        /* A tween allocates its waitlist with the first waiter. Copies still start without one and copy-assignment
+         * keeps the waiters of the assigned tween, as for the waitlist itself */
+        template<>
+        struct cold<waitlist> {
+            std::unique_ptr<waitlist> object;
+
+            cold() = default;
+            cold(const cold &) { }
+            cold(cold && other) = default;
+            cold & operator=(const cold &) { return *this; }
+            cold & operator=(cold && other) = default;
+        };
+
+        /* The object returned by tween::finished and tween::reaches. It is only used through co_await. */
+        template<typename TweenT>
+        struct awaiter {
+            TweenT & tween;
+            uint32_t time;
+
+            bool await_ready() const {
+                return time == waiter::finished ? tween.isFinished() : tween.currentTimePoint() == time;
+            }
+
+            template<typename HandleT>
+            void await_suspend(HandleT handle) {
+                tween.wait(waiter{time, handle.address(),
+                    [](void * address) { HandleT::from_address(address).resume(); },
+                    [](void * address) { HandleT::from_address(address).destroy(); }});
+            }
+
+            void await_resume() const { }
+        };
+    }
+
+#ifdef TWEENY_HAS_COROUTINES
+    /**
+     * @brief A minimal coroutine type to await tweens.
+     *
+     * It starts running immediately and runs until its first `co_await`. It is then resumed by the awaited tween,
+     * from within the tween::step or tween::seek call that made the awaited event happen. If the awaited tween is
+     * destroyed or moved over first, the coroutine is destroyed without being resumed. It is only available when
+     * compiling with C++20 coroutines.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::task show(tweeny::tween<float> & fade, tweeny::tween<float> & slide) {
+     *     co_await fade.finished();
+     *     co_await slide.reaches(500);
+     *     puts("halfway there");
+     * }
+     * @endcode
+     * @sa tween::finished, tween::reaches
+     */
+    struct task {
+        struct promise_type {
+            task get_return_object() { return task{}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() { }
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+#endif
+}
+
+#endif //TWEENY_AWAITER_H
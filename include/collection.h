@@ -0,0 +1,430 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file collection.h
+ * This file declares the collection class, which steps many tweens of the same type together.
+ */
+
+#ifndef TWEENY_COLLECTION_H
+#define TWEENY_COLLECTION_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <type_traits>
+#include <utility>
+
+#include "tween.h"
+#include "dispatcher.h"
+#include "triplebuffer.h"
+
+namespace tweeny {
+    namespace detail {
+        /* A callback to be called for a tween in a collection, recorded by collection::defer */
+        struct event {
+            enum : uint8_t { step, seek, loop, cue };
+            uint32_t index; // tween index
+            uint32_t count; // how many times to call it, or the time point of the cues to call
+            uint8_t kind;
+        };
+
+        /* The update rate of a tween in a collection, set by collection::throttle */
+        struct level {
+            uint32_t interval; // steps between two updates of the tween
+            double pending; // milliseconds accumulated since the last update
+        };
+
+        /* A tween point following the values of another tween, set by collection::link */
+        struct link {
+            uint32_t target; // index of the following tween
+            uint32_t point; // index of the following point in it
+            uint32_t source; // index of the tween being followed
+
+            bool operator<(const link & other) const { return target < other.target; }
+        };
+
+        /* The tweens of a collection. Their playback states are kept in one array, so that collection::snapshot and
+         * collection::restore copy them all at once, and each tween refers to its own state in it */
+        template<typename TweenT>
+        struct roster : std::vector<TweenT> {
+            std::vector<typename TweenT::stateType> states;
+
+            roster() = default;
+            roster(const roster & other) : std::vector<TweenT>(other), states(other.states) { seat(); }
+            roster(roster && other) = default; // buffers are moved along, so tweens still refer to their states
+            roster & operator=(const roster & other) { return *this = roster(other); }
+            roster & operator=(roster && other) = default;
+
+            /* Adds a copy of a tween, seating every tween again if an array grew */
+            void add(const TweenT & t) {
+                bool grows = this->size() == this->capacity();
+                if (grows) unseat(); // growing moves the tweens, which would move their states out of the array
+                this->push_back(t);
+                const typename TweenT::stateType * first = states.data();
+                states.push_back(*this->back().state);
+                if (grows || states.data() != first) seat();
+                else this->back().state.at = &states.back();
+            }
+
+            void seat() {
+                for (size_t i = 0; i < this->size(); ++i) (*this)[i].state.at = &states[i];
+            }
+
+            void unseat() {
+                for (TweenT & t : *this) {
+                    t.state.own = *t.state.at;
+                    t.state.at = &t.state.own;
+                }
+            }
+        };
+
+        /* Assigns the values of a tween to the values of a tween point */
+        template<typename V>
+        void assign(V & values, const V & from) { values = from; }
+
+        template<typename T>
+        void assign(std::array<T, 1> & values, const T & from) { values[0] = from; }
+    }
+
+    /**
+     * @brief A collection of tweens with the same value types, stepped and seeked together.
+     *
+     * Tweens are stored contiguously and are identified by the index returned by collection::add. Besides
+     * saving you a loop, a collection can write the values of all its tweens straight into your own buffers.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::collection<float, float> sprites;
+     * sprites.add(tweeny::from(0.0f, 0.0f).to(100.0f, 100.0f).during(100));
+     * sprites.add(tweeny::from(50.0f, 50.0f).to(0.0f, 0.0f).during(200));
+     * sprites.step(16);
+     * @endcode
+     */
+    template<typename T, typename... Ts>
+    class collection {
+        public:
+            /**
+             * @brief The type of the values of each tween, as returned by tween::peek
+             */
+            typedef typename std::decay<decltype(std::declval<tween<T, Ts...>>().peek())>::type valuesType;
+
+            /**
+             * @brief The playback state of a collection, filled by collection::snapshot
+             */
+            struct stateType {
+                std::vector<typename tween<T, Ts...>::stateType> tweens; ///< The state of each tween
+                std::vector<double> pending; ///< Time each throttled tween has not been stepped by yet
+                uint32_t frame = 0; ///< Steps so far, which decide when throttled tweens are stepped
+            };
+
+            /**
+             * @brief Adds a tween to this collection.
+             *
+             * The tween is copied into the collection. If the collection is bound to external storage, the tween is
+             * bound to its slot in it.
+             *
+             * @param t The tween to add
+             * @returns The index of the tween in this collection
+             */
+            size_t add(const tween<T, Ts...> & t);
+
+            /**
+             * @brief Returns the tween at an index.
+             *
+             * @param index A value returned by collection::add
+             * @returns The tween
+             */
+            tween<T, Ts...> & operator[](size_t index);
+            const tween<T, Ts...> & operator[](size_t index) const; ///< @sa collection::operator[]
+
+            /**
+             * @brief Returns the number of tweens in this collection.
+             */
+            size_t size() const;
+
+            typename std::vector<tween<T, Ts...>>::iterator begin(); ///< Iterator to the first tween
+            typename std::vector<tween<T, Ts...>>::iterator end(); ///< Iterator past the last tween
+            typename std::vector<tween<T, Ts...>>::const_iterator begin() const; ///< Iterator to the first tween
+            typename std::vector<tween<T, Ts...>>::const_iterator end() const; ///< Iterator past the last tween
+
+            /**
+             * @brief Steps every tween in this collection.
+             *
+             * @param dt Any delta accepted by tween::step
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with tween::onStep()
+             * @sa tween::step
+             */
+            template<typename D> void step(D dt, bool suppressCallbacks = false);
+
+            /**
+             * @brief Seeks every tween in this collection.
+             *
+             * @param p Any time point or percentage accepted by tween::seek
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with tween::onSeek()
+             * @sa tween::seek
+             */
+            template<typename P> void seek(P p, bool suppressCallbacks = false);
+
+            /**
+             * @brief Binds the values of every tween to arrays, one for each value (structure of arrays).
+             *
+             * The values of the tween at index `i` are written to `t[i]`, `vs[i]...`. Arrays must be large enough for
+             * every tween in the collection, including the ones added later. Pass `nullptr` to leave a value unbound.
+             *
+             * **Example**:
+             *
+             * @code
+             * std::vector<float> xs(100), ys(100);
+             * tweeny::collection<float, float> c;
+             * c.bind(xs.data(), ys.data());
+             * @endcode
+             *
+             * @param t, vs The arrays
+             * @returns *this
+             * @sa tween::bind
+             */
+            collection<T, Ts...> & bind(T * t, Ts * ... vs);
+
+            /**
+             * @brief Binds the values of every tween to a strided buffer.
+             *
+             * The values of the tween at index `i` are written `i * stride` bytes after each pointer. This is useful
+             * to write into an array of structures, or into a vertex buffer, without repacking it.
+             *
+             * **Example**:
+             *
+             * @code
+             * struct vertex { float x, y, u, v; };
+             * std::vector<vertex> vertices(100);
+             * tweeny::collection<float, float> c;
+             * c.bind(sizeof(vertex), &vertices[0].x, &vertices[0].y);
+             * @endcode
+             *
+             * @param stride The distance, in bytes, between the values of two consecutive tweens
+             * @param t, vs Pointers to the values of the first tween
+             * @returns *this
+             * @sa tween::bind
+             */
+            collection<T, Ts...> & bind(size_t stride, T * t, Ts * ... vs);
+
+            /**
+             * @brief Makes this collection publish the values of all its tweens for another thread to read.
+             *
+             * After each collection::step and collection::seek, the values of every tween are copied into a triple
+             * buffer. Another thread can then call collection::latest() to get them without locking. Unlike
+             * publishing each tween with tween::publish, values read this way always come from the same step.
+             *
+             * @param enabled Set to false to stop publishing
+             * @returns *this
+             * @sa tween::publish
+             */
+            collection<T, Ts...> & publish(bool enabled = true);
+
+            /**
+             * @brief Returns the values last published by this collection, indexed like the tweens.
+             *
+             * This is safe to call from a thread other than the one stepping the collection, as long as only one
+             * thread calls it. The returned reference is valid until the next call.
+             *
+             * @returns The latest published values of every tween
+             * @sa publish
+             */
+            const std::vector<valuesType> & latest();
+
+            /**
+             * @brief Defers callbacks of stepping and seeking until collection::flush is called.
+             *
+             * When deferring, collection::step and collection::seek only interpolate values and record which tweens
+             * have callbacks to call, so that stepping many tweens is not interleaved with running callbacks.
+             * Calling collection::flush runs the recorded callbacks, grouped by tween. Callbacks see the values of
+             * their tween at the time of the flush.
+             *
+             * **Example**:
+             *
+             * @code
+             * collection.defer();
+             * collection.step(16);
+             * collection.flush(); // calls onStep, onLoop and cue callbacks of all tweens
+             * @endcode
+             *
+             * @param enabled Set to false to call callbacks while stepping again
+             * @returns *this
+             * @sa flush
+             */
+            collection<T, Ts...> & defer(bool enabled = true);
+
+            /**
+             * @brief Calls the callbacks recorded while deferring.
+             *
+             * Callbacks of each tween are called in the same order they would have been while stepping. Returning
+             * true from a callback dismisses it, as usual.
+             *
+             * @sa defer
+             */
+            void flush();
+
+            /**
+             * @brief Updates a tween only once every few steps of this collection.
+             *
+             * A throttled tween skips steps, accumulating their deltas, and is stepped by their sum on every
+             * `interval`-th call to collection::step. Use it for tweens that do not need to be updated at full rate,
+             * like the ones animating distant or hidden objects. Updates of tweens with the same interval are
+             * staggered across steps, so that the work is spread evenly instead of happening all at once.
+             *
+             * Callbacks of a throttled tween are only called when it is updated. Seeking is not throttled.
+             *
+             * **Example**:
+             *
+             * @code
+             * for (size_t i : farAway) sprites.throttle(i, 4); // updated at a quarter of the rate
+             * @endcode
+             *
+             * @param index A value returned by collection::add
+             * @param interval Number of steps between two updates. 1 updates the tween at every step
+             * @returns *this
+             * @sa promote
+             */
+            collection<T, Ts...> & throttle(size_t index, uint32_t interval);
+
+            /**
+             * @brief Brings a throttled tween back to full rate.
+             *
+             * The tween is immediately stepped by the deltas it has accumulated, so that it is up to date.
+             *
+             * @param index A value returned by collection::add
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with tween::onStep()
+             * @returns *this
+             * @sa throttle
+             */
+            collection<T, Ts...> & promote(size_t index, bool suppressCallbacks = false);
+
+            /**
+             * @brief Makes a point of a tween follow the values of another tween.
+             *
+             * Whenever the followed tween changes, its values are copied into that point, so that a tween can go to
+             * (or come from) wherever another one is, like an object following a moving target. Tweens can follow
+             * tweens that follow others: collection::step and collection::seek update them in dependency order, and
+             * only update points whose followed tween actually changed in that step. A tween that follows a moving
+             * one is rendered again even if it is finished.
+             *
+             * **Example**:
+             *
+             * @code
+             * tweeny::collection<float, float> objects;
+             * size_t target = objects.add(tweeny::from(0.0f, 0.0f).to(100.0f, 50.0f).during(1000));
+             * size_t follower = objects.add(tweeny::from(0.0f, 0.0f).to(0.0f, 0.0f).during(500));
+             * objects.link(follower, 1, target); // the follower goes to wherever the target is
+             * @endcode
+             *
+             * @param index A value returned by collection::add, of the tween that follows
+             * @param point The index of the point of that tween that follows
+             * @param source A value returned by collection::add, of the tween to follow
+             * @returns *this
+             * @throws std::logic_error if tweens would follow each other in a cycle. The link is not made.
+             * @throws std::out_of_range if there is no such point
+             * @sa unlink
+             */
+            collection<T, Ts...> & link(size_t index, size_t point, size_t source);
+
+            /**
+             * @brief Makes a tween point stop following other tweens. It keeps its last values.
+             *
+             * @param index A value returned by collection::add
+             * @param point The index of the point
+             * @returns *this
+             * @sa link
+             */
+            collection<T, Ts...> & unlink(size_t index, size_t point);
+
+            /**
+             * @brief Copies the playback state of every tween into a buffer.
+             *
+             * A collection keeps the states of its tweens in one array, so they are saved with a single copy. The buffer
+             * only grows when the collection does, so saving the same collection over and over does not allocate.
+             * Together with collection::restore, this lets you rewind every animation of a game, as in
+             * rollback networking. The time throttled tweens have not caught up with yet is saved too, so replaying
+             * the same steps after a restore gives the same values.
+             *
+             * **Example**:
+             *
+             * @code
+             * tweeny::collection<float>::stateType saved;
+             * sprites.snapshot(saved);
+             * sprites.step(16);
+             * sprites.restore(saved); // back to where they were
+             * @endcode
+             *
+             * @param state Where to copy the state, resized to the number of tweens
+             * @sa tween::snapshot
+             */
+            void snapshot(stateType & state) const;
+
+            /**
+             * @brief Restores the states copied by collection::snapshot.
+             *
+             * No callbacks are called. Points linked with collection::link follow the restored tweens.
+             *
+             * @param state A state with one state per tween
+             * @throws std::invalid_argument if there is not one state per tween
+             * @sa tween::restore
+             */
+            void restore(const stateType & state);
+
+        private /* member types */:
+            using traits = detail::tweentraits<T, Ts...>;
+
+        private /* member variables */:
+            detail::roster<tween<T, Ts...>> tweens; // with their playback states, see detail::roster
+            typename traits::outputsType outputs; // external storage of the first tween
+            std::array<size_t, sizeof...(Ts) + 1> strides = {{ }}; // distance in bytes between two tweens in each output
+            bool bound = false; // whether collection::bind was called
+            detail::triplebuffer<std::vector<valuesType>> snapshots; // values published to other threads
+            bool published = false; // whether step and seek publish values
+            std::vector<detail::event> events; // callbacks recorded while deferring
+            bool deferred = false; // whether step and seek record callbacks instead of calling them
+            std::vector<detail::level> levels; // update rates, empty until collection::throttle is called
+            uint32_t frame = 0; // number of steps so far, to stagger throttled tweens
+            std::vector<detail::link> links; // sorted by target
+            std::vector<uint32_t> order; // indices of tweens sorted so that they come after the ones they follow
+            std::vector<uint8_t> dirty; // whether each tween changed in the current step, to update its followers
+
+        private:
+            /* member functions */
+            template<int... S> void attach(size_t index, detail::seq<S...>);
+            void share();
+            template<typename F> void update(size_t index, F stepper, bool suppress);
+            void record(uint32_t index, uint32_t from, uint32_t to);
+            bool follow(size_t index, bool force);
+            void sort();
+    };
+}
+
+#include "collection.tcc"
+
+#endif //TWEENY_COLLECTION_H
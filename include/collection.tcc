@@ -0,0 +1,361 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * This file provides the implementation for collection.h
+ */
+
+#ifndef TWEENY_COLLECTION_TCC
+#define TWEENY_COLLECTION_TCC
+
+#include <algorithm>
+
+#include "collection.h"
+
+namespace tweeny {
+    namespace detail {
+        template<typename T>
+        T * offset(T * p, size_t bytes) {
+            return p ? reinterpret_cast<T *>(reinterpret_cast<char *>(p) + bytes) : nullptr;
+        }
+
+        /* Converts any delta accepted by tween::step into milliseconds of that tween */
+        template<typename TweenT>
+        double elapsed(const TweenT &, int32_t dt) { return dt; }
+
+        template<typename TweenT>
+        double elapsed(const TweenT &, uint32_t dt) { return dt; }
+
+        template<typename TweenT>
+        double elapsed(const TweenT & t, float dp) { return static_cast<double>(dp) * t.duration(); }
+
+        template<typename TweenT, typename Rep, typename Period>
+        double elapsed(const TweenT &, std::chrono::duration<Rep, Period> dt) {
+            typedef std::ratio_divide<Period, std::milli> ratio;
+            return static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den);
+        }
+    }
+
+    template<typename T, typename... Ts>
+    size_t collection<T, Ts...>::add(const tween<T, Ts...> & t) {
+        tweens.add(t);
+        if (bound) attach(tweens.size() - 1, typename detail::gens<sizeof...(Ts) + 1>::type());
+        if (!links.empty()) {
+            order.push_back(static_cast<uint32_t>(tweens.size() - 1)); // follows nothing, so it can go anywhere
+            dirty.push_back(0);
+        }
+        return tweens.size() - 1;
+    }
+
+    template<typename T, typename... Ts>
+    inline tween<T, Ts...> & collection<T, Ts...>::operator[](size_t index) {
+        return tweens[index];
+    }
+
+    template<typename T, typename... Ts>
+    inline const tween<T, Ts...> & collection<T, Ts...>::operator[](size_t index) const {
+        return tweens[index];
+    }
+
+    template<typename T, typename... Ts>
+    inline size_t collection<T, Ts...>::size() const {
+        return tweens.size();
+    }
+
+    template<typename T, typename... Ts>
+    inline typename std::vector<tween<T, Ts...>>::iterator collection<T, Ts...>::begin() {
+        return tweens.begin();
+    }
+
+    template<typename T, typename... Ts>
+    inline typename std::vector<tween<T, Ts...>>::iterator collection<T, Ts...>::end() {
+        return tweens.end();
+    }
+
+    template<typename T, typename... Ts>
+    inline typename std::vector<tween<T, Ts...>>::const_iterator collection<T, Ts...>::begin() const {
+        return tweens.begin();
+    }
+
+    template<typename T, typename... Ts>
+    inline typename std::vector<tween<T, Ts...>>::const_iterator collection<T, Ts...>::end() const {
+        return tweens.end();
+    }
+
+    template<typename T, typename... Ts>
+    template<typename D>
+    void collection<T, Ts...>::step(D dt, bool suppress) {
+        if (levels.empty() && !deferred && links.empty()) {
+            for (tween<T, Ts...> & t : tweens) t.step(dt, suppress);
+        } else {
+            for (size_t k = 0; k < tweens.size(); ++k) {
+                size_t i = order.empty() ? k : order[k];
+                tween<T, Ts...> & t = tweens[i];
+                bool followed = !links.empty() && follow(i, false);
+                uint32_t progress = t.state->progress;
+                uint32_t cycle = t.state->cycle;
+                if (i < levels.size() && levels[i].interval > 1) {
+                    detail::level & l = levels[i];
+                    l.pending += detail::elapsed(t, dt);
+                    if ((frame + i) % l.interval == 0) {
+                        double pending = l.pending;
+                        l.pending = 0;
+                        update(i, [pending](tween<T, Ts...> & t, bool quiet) { t.elapse(pending, quiet); }, suppress);
+                    }
+                } else {
+                    update(i, [dt](tween<T, Ts...> & t, bool quiet) { t.step(dt, quiet); }, suppress);
+                }
+                if (links.empty()) continue;
+                bool moved = progress != t.state->progress || cycle != t.state->cycle;
+                if (followed && !moved) t.render(t.state->progress);
+                dirty[i] = moved || followed;
+            }
+        }
+        ++frame;
+        if (published) share();
+    }
+
+    template<typename T, typename... Ts>
+    template<typename P>
+    void collection<T, Ts...>::seek(P p, bool suppress) {
+        for (size_t k = 0; k < tweens.size(); ++k) {
+            size_t i = order.empty() ? k : order[k];
+            if (!links.empty()) follow(i, true);
+            tween<T, Ts...> & t = tweens[i];
+            uint32_t from = t.state->progress;
+            t.seek(p, suppress || deferred);
+            if (!deferred || suppress) continue;
+            if (!t.onSeekCallbacks.empty()) events.push_back(detail::event{static_cast<uint32_t>(i), 1, detail::event::seek});
+            if (t.cues.object) record(static_cast<uint32_t>(i), from, t.state->progress);
+        }
+        if (published) share();
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::bind(T * t, Ts * ... vs) {
+        outputs = std::make_tuple(t, vs...);
+        bound = true;
+        strides = {{ sizeof(T), sizeof(Ts)... }};
+        for (size_t i = 0; i < tweens.size(); ++i) attach(i, typename detail::gens<sizeof...(Ts) + 1>::type());
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::bind(size_t stride, T * t, Ts * ... vs) {
+        outputs = std::make_tuple(t, vs...);
+        bound = true;
+        strides.fill(stride);
+        for (size_t i = 0; i < tweens.size(); ++i) attach(i, typename detail::gens<sizeof...(Ts) + 1>::type());
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::publish(bool enabled) {
+        published = enabled;
+        if (published) share();
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    const std::vector<typename collection<T, Ts...>::valuesType> & collection<T, Ts...>::latest() {
+        return snapshots.read();
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::defer(bool enabled) {
+        deferred = enabled;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::flush() {
+        std::stable_sort(events.begin(), events.end(), [](const detail::event & a, const detail::event & b) {
+            return a.index < b.index;
+        });
+        for (const detail::event & e : events) {
+            tween<T, Ts...> & t = tweens[e.index];
+            if (e.kind == detail::event::cue) {
+                t.ring(e.count);
+                continue;
+            }
+            auto & callbacks = e.kind == detail::event::step ? t.onStepCallbacks
+                             : e.kind == detail::event::seek ? t.onSeekCallbacks
+                             : *t.onLoopCallbacks.object;
+            for (uint32_t i = 0; i < e.count; ++i) t.dispatch(callbacks);
+        }
+        events.clear();
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::throttle(size_t index, uint32_t interval) {
+        if (levels.size() < tweens.size()) levels.resize(tweens.size(), detail::level{1, 0});
+        levels[index].interval = interval > 0 ? interval : 1;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::promote(size_t index, bool suppress) {
+        if (index >= levels.size()) return *this;
+        double pending = levels[index].pending;
+        levels[index] = detail::level{1, 0};
+        if (pending != 0) update(index, [pending](tween<T, Ts...> & t, bool quiet) { t.elapse(pending, quiet); }, suppress);
+        if (published) share();
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    template<typename F>
+    void collection<T, Ts...>::update(size_t index, F stepper, bool suppress) {
+        tween<T, Ts...> & t = tweens[index];
+        if (!deferred || suppress) {
+            stepper(t, suppress);
+            return;
+        }
+        uint32_t cycle = t.state->cycle;
+        int64_t origin = t.unfolded();
+        stepper(t, true);
+        uint32_t i = static_cast<uint32_t>(index);
+        if (t.cues.object && t.total > 0) t.sweep(origin, t.unfolded(), [this, i](uint32_t a, uint32_t b) { record(i, a, b); });
+        if (cycle != t.state->cycle && t.onLoopCallbacks.object && !t.onLoopCallbacks.object->empty()) {
+            uint32_t wraps = cycle < t.state->cycle ? t.state->cycle - cycle : cycle - t.state->cycle;
+            events.push_back(detail::event{i, wraps, detail::event::loop});
+        }
+        if (!t.onStepCallbacks.empty()) events.push_back(detail::event{i, 1, detail::event::step});
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::record(uint32_t index, uint32_t from, uint32_t to) {
+        /* Cues at the same time point are called together by tween::ring, so they are recorded once */
+        const tween<T, Ts...> & t = tweens[index];
+        size_t recorded = events.size();
+        t.pass(from, to, [this, &t, index, recorded](size_t c) {
+            uint32_t time = (*t.cues.object)[c].time;
+            if (events.size() > recorded && events.back().count == time) return;
+            events.push_back(detail::event{index, time, detail::event::cue});
+        });
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::link(size_t index, size_t point, size_t source) {
+        tweens.at(index).points.at(point); // throws std::out_of_range for invalid indices
+        tweens.at(source);
+        detail::link l{static_cast<uint32_t>(index), static_cast<uint32_t>(point), static_cast<uint32_t>(source)};
+        auto position = links.insert(std::upper_bound(links.begin(), links.end(), l), l);
+        try {
+            sort();
+        } catch (...) {
+            links.erase(position);
+            throw;
+        }
+        dirty.assign(tweens.size(), 0);
+        follow(index, true);
+        tweens[index].render(tweens[index].state->progress);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    collection<T, Ts...> & collection<T, Ts...>::unlink(size_t index, size_t point) {
+        links.erase(std::remove_if(links.begin(), links.end(), [index, point](const detail::link & l) {
+            return l.target == index && l.point == point;
+        }), links.end());
+        if (links.empty()) {
+            order.clear();
+            dirty.clear();
+        } else {
+            sort();
+        }
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    bool collection<T, Ts...>::follow(size_t index, bool force) {
+        auto range = std::equal_range(links.begin(), links.end(), detail::link{static_cast<uint32_t>(index), 0, 0});
+        bool followed = false;
+        for (auto l = range.first; l != range.second; ++l) {
+            if (!force && !dirty[l->source]) continue;
+            detail::assign(tweens[index].points[l->point].values, tweens[l->source].state->current);
+            followed = true;
+        }
+        return followed;
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::sort() {
+        /* Kahn's algorithm: repeatedly takes tweens that follow no tween left to take */
+        std::vector<detail::link> bySource(links);
+        std::sort(bySource.begin(), bySource.end(), [](const detail::link & a, const detail::link & b) {
+            return a.source < b.source;
+        });
+        std::vector<uint32_t> incoming(tweens.size(), 0);
+        for (const detail::link & l : links) incoming[l.target]++;
+        std::vector<uint32_t> sorted;
+        sorted.reserve(tweens.size());
+        for (uint32_t i = 0; i < tweens.size(); ++i) if (incoming[i] == 0) sorted.push_back(i);
+        for (size_t k = 0; k < sorted.size(); ++k) {
+            uint32_t source = sorted[k];
+            auto l = std::lower_bound(bySource.begin(), bySource.end(), source, [](const detail::link & a, uint32_t b) {
+                return a.source < b;
+            });
+            for (; l != bySource.end() && l->source == source; ++l)
+                if (--incoming[l->target] == 0) sorted.push_back(l->target);
+        }
+        if (sorted.size() < tweens.size()) throw std::logic_error("tweeny::collection::link: tweens would follow each other in a cycle");
+        order.swap(sorted);
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::snapshot(stateType & state) const {
+        state.tweens = tweens.states;
+        state.pending.resize(levels.size());
+        for (size_t i = 0; i < levels.size(); ++i) state.pending[i] = levels[i].pending;
+        state.frame = frame;
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::restore(const stateType & state) {
+        if (state.tweens.size() != tweens.size()) throw std::invalid_argument("There must be one state per tween");
+        std::copy(state.tweens.begin(), state.tweens.end(), tweens.states.begin()); // in place, as tweens refer to them
+        for (auto & t : tweens) t.present();
+        for (size_t i : order) follow(i, true);
+        for (size_t i = 0; i < levels.size(); ++i) levels[i].pending = i < state.pending.size() ? state.pending[i] : 0;
+        frame = state.frame;
+        if (published) share();
+    }
+
+    template<typename T, typename... Ts>
+    void collection<T, Ts...>::share() {
+        std::vector<valuesType> & values = snapshots.next();
+        values.resize(tweens.size());
+        for (size_t i = 0; i < tweens.size(); ++i) values[i] = tweens[i].peek();
+        snapshots.publish();
+    }
+
+    template<typename T, typename... Ts>
+    template<int... S>
+    void collection<T, Ts...>::attach(size_t index, detail::seq<S...>) {
+        tweens[index].bind(detail::offset(std::get<S>(outputs), strides[S] * index)...);
+    }
+}
+
+#endif //TWEENY_COLLECTION_TCC
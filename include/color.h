@@ -0,0 +1,141 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file color.h
+ * This file declares tweeny::rgba, a packed 8 bits per channel color that tweens blend all channels of at once.
+ */
+
+#ifndef TWEENY_COLOR_H
+#define TWEENY_COLOR_H
+
+#include <cstdint>
+
+#include "easing.h"
+#include "easingresolve.h"
+
+namespace tweeny {
+    /**
+     * @brief A color with four 8 bits channels, packed in a 32 bits integer as `0xRRGGBBAA`.
+     *
+     * Tweening an rgba costs one evaluation of the easing and one blend of all four channels within an integer, instead
+     * of easing four values. Every bundled easing and combinator works with it through tween::via, and overshooting
+     * easings, like easing::backOut, saturate channels at 0 and 255.
+     *
+     * Channels are blended as they are stored, in sRGB. Wrap an easing in easing::linearLight to blend them in linear
+     * light instead. The velocity of an rgba tween is an rgba::velocity, the signed rate of change of each channel.
+     *
+     * **Example**:
+     *
+     * @code
+     * auto fade = tweeny::from(tweeny::rgba(0xff8000ff)).to(tweeny::rgba(0x0080ff00)).during(300).via(tweeny::easing::cubicOut);
+     * uint32_t packed = fade.step(16).packed;
+     * @endcode
+     */
+    struct rgba {
+        uint32_t packed = 0; ///< The channels, red in the highest byte and alpha in the lowest
+
+        rgba() = default;
+        explicit rgba(uint32_t p) : packed(p) { } ///< Constructs a color from its packed channels
+        rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) ///< Constructs a color from its channels
+            : packed(uint32_t(r) << 24 | uint32_t(g) << 16 | uint32_t(b) << 8 | a) { }
+
+        uint8_t r() const { return static_cast<uint8_t>(packed >> 24); } ///< Returns the red channel
+        uint8_t g() const { return static_cast<uint8_t>(packed >> 16); } ///< Returns the green channel
+        uint8_t b() const { return static_cast<uint8_t>(packed >> 8); } ///< Returns the blue channel
+        uint8_t a() const { return static_cast<uint8_t>(packed); } ///< Returns the alpha channel
+
+        bool operator==(const rgba & other) const { return packed == other.packed; }
+        bool operator!=(const rgba & other) const { return packed != other.packed; }
+
+        /**
+         * @brief The velocity of a color, in channel values per duration unit for each channel. Channels going
+         * down have a negative velocity.
+         */
+        struct velocity {
+            float r, g, b, a;
+
+            velocity() : r(0), g(0), b(0), a(0) { }
+            velocity(float red, float green, float blue, float alpha) : r(red), g(green), b(blue), a(alpha) { }
+
+            friend velocity operator+(const velocity & x, const velocity & y) { return { x.r + y.r, x.g + y.g, x.b + y.b, x.a + y.a }; }
+            friend velocity operator-(const velocity & x, const velocity & y) { return { x.r - y.r, x.g - y.g, x.b - y.b, x.a - y.a }; }
+            friend velocity operator*(const velocity & x, const velocity & y) { return { x.r * y.r, x.g * y.g, x.b * y.b, x.a * y.a }; }
+            friend velocity operator*(const velocity & x, float f) { return { x.r * f, x.g * f, x.b * f, x.a * f }; }
+            friend velocity operator*(float f, const velocity & x) { return x * f; }
+        };
+    };
+
+    namespace detail {
+        /* Blends two packed colors by a weight in 256ths, two channels at a time in each half of an integer */
+        uint32_t lerp(uint32_t from, uint32_t to, uint32_t weight);
+
+        /* Blends two packed colors channel by channel, saturating weights out of the [0, 1] range */
+        uint32_t extrapolate(uint32_t from, uint32_t to, float weight);
+
+        /* Blends the color channels of two packed colors in linear light, and their alpha as it is */
+        uint32_t lighten(uint32_t from, uint32_t to, float weight);
+
+        /* Returns the rate of change of each channel, for a slope of the eased position */
+        rgba::velocity rate(uint32_t from, uint32_t to, float slope);
+
+        /* Colors change by fractions of a channel value, in both directions */
+        template<>
+        struct ratetype<rgba> {
+            typedef rgba::velocity type;
+        };
+
+        /* Adds a bump to each channel of a color, saturating them, see tween::retarget */
+        template<>
+        rgba bump<rgba>(const rgba & v, const rgba::velocity & height, float t);
+
+        /* Lookup tables between sRGB channels and linear light */
+        struct srgb {
+            float decoded[256]; // linear light of each channel value
+            uint8_t encoded[4097]; // channel value of linear light, in 4096ths
+
+            srgb();
+            static const srgb & tables();
+        };
+
+        /* Colors ease by the easing of a position from 0 to 1, then by blending their channels */
+        template<typename EasingT>
+        struct curveof<EasingT, rgba> {
+            static rgba run(float position, const rgba & start, const rgba & end);
+            static rgba::velocity velocity(float position, const rgba & start, const rgba & end);
+            static const curve<rgba> value;
+        };
+
+        template<typename EasingT>
+        struct curveof<easing::linearLight<EasingT>, rgba> {
+            static rgba run(float position, const rgba & start, const rgba & end);
+            static rgba::velocity velocity(float position, const rgba & start, const rgba & end);
+            static const curve<rgba> value;
+        };
+    }
+}
+
+#include "color.tcc"
+
+#endif //TWEENY_COLOR_H
@@ -0,0 +1,138 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the color.h file.
+ */
+
+#ifndef TWEENY_COLOR_TCC
+#define TWEENY_COLOR_TCC
+
+#include <algorithm>
+#include <cmath>
+
+#include "color.h"
+
+namespace tweeny {
+    namespace detail {
+        inline uint32_t lerp(uint32_t from, uint32_t to, uint32_t weight) {
+            /* Each channel is spread over 16 bits, where a weighted sum of two channels cannot overflow */
+            uint32_t keep = 256 - weight;
+            uint32_t even = ((from & 0x00ff00ffu) * keep + (to & 0x00ff00ffu) * weight + 0x00800080u) >> 8;
+            uint32_t odd = ((from >> 8 & 0x00ff00ffu) * keep + (to >> 8 & 0x00ff00ffu) * weight + 0x00800080u);
+            return (even & 0x00ff00ffu) | (odd & 0xff00ff00u);
+        }
+
+        inline uint32_t extrapolate(uint32_t from, uint32_t to, float weight) {
+            uint32_t result = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                float a = static_cast<float>(from >> shift & 0xffu), b = static_cast<float>(to >> shift & 0xffu);
+                float c = std::round(a + (b - a) * weight);
+                result |= static_cast<uint32_t>(std::min(255.0f, std::max(0.0f, c))) << shift;
+            }
+            return result;
+        }
+
+        inline uint32_t lighten(uint32_t from, uint32_t to, float weight) {
+            const srgb & t = srgb::tables();
+            uint32_t result = extrapolate(from & 0xffu, to & 0xffu, weight);
+            for (int shift = 8; shift < 32; shift += 8) {
+                float a = t.decoded[from >> shift & 0xffu], b = t.decoded[to >> shift & 0xffu];
+                float l = std::min(1.0f, std::max(0.0f, a + (b - a) * weight));
+                result |= uint32_t(t.encoded[static_cast<int>(l * 4096 + 0.5f)]) << shift;
+            }
+            return result;
+        }
+
+        inline rgba::velocity rate(uint32_t from, uint32_t to, float slope) {
+            float channels[4];
+            for (int i = 0; i < 4; ++i) {
+                int shift = 24 - 8 * i;
+                channels[i] = (static_cast<float>(to >> shift & 0xffu) - static_cast<float>(from >> shift & 0xffu)) * slope;
+            }
+            return rgba::velocity(channels[0], channels[1], channels[2], channels[3]);
+        }
+
+        template<>
+        inline rgba bump<rgba>(const rgba & v, const rgba::velocity & height, float t) {
+            const float heights[4] = { height.r, height.g, height.b, height.a };
+            float weight = t * (1 - t) * (1 - t);
+            uint32_t result = 0;
+            for (int i = 0; i < 4; ++i) {
+                int shift = 24 - 8 * i;
+                float c = std::round(static_cast<float>(v.packed >> shift & 0xffu) + heights[i] * weight);
+                result |= static_cast<uint32_t>(std::min(255.0f, std::max(0.0f, c))) << shift;
+            }
+            return rgba(result);
+        }
+
+        inline srgb::srgb() {
+            for (int i = 0; i < 256; ++i) {
+                double c = i / 255.0;
+                decoded[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+            }
+            for (int i = 0; i <= 4096; ++i) {
+                double l = i / 4096.0;
+                double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1 / 2.4) - 0.055;
+                encoded[i] = static_cast<uint8_t>(std::lround(c * 255));
+            }
+        }
+
+        inline const srgb & srgb::tables() {
+            static const srgb instance;
+            return instance;
+        }
+
+        template<typename EasingT>
+        rgba curveof<EasingT, rgba>::run(float position, const rgba & start, const rgba & end) {
+            float weight = EasingT::template run<float>(position, 0.0f, 1.0f);
+            if (weight >= 0.0f && weight <= 1.0f)
+                return rgba(lerp(start.packed, end.packed, static_cast<uint32_t>(weight * 256 + 0.5f)));
+            return rgba(extrapolate(start.packed, end.packed, weight));
+        }
+
+        template<typename EasingT>
+        rgba::velocity curveof<EasingT, rgba>::velocity(float position, const rgba & start, const rgba & end) {
+            return rate(start.packed, end.packed, EasingT::template velocity<float>(position, 0.0f, 1.0f));
+        }
+
+        template<typename EasingT>
+        const curve<rgba> curveof<EasingT, rgba>::value = { &run, &velocity, nullptr };
+
+        template<typename EasingT>
+        rgba curveof<easing::linearLight<EasingT>, rgba>::run(float position, const rgba & start, const rgba & end) {
+            return rgba(lighten(start.packed, end.packed, EasingT::template run<float>(position, 0.0f, 1.0f)));
+        }
+
+        template<typename EasingT>
+        rgba::velocity curveof<easing::linearLight<EasingT>, rgba>::velocity(float position, const rgba & start, const rgba & end) {
+            return rate(start.packed, end.packed, EasingT::template velocity<float>(position, 0.0f, 1.0f));
+        }
+
+        template<typename EasingT>
+        const curve<rgba> curveof<easing::linearLight<EasingT>, rgba>::value = { &run, &velocity, nullptr };
+    }
+}
+
+#endif //TWEENY_COLOR_TCC
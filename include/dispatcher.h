@@ -47,6 +47,12 @@ namespace tweeny {
         R call(Func && f, const std::tuple<Ts...> & args) {
             return dispatch<R>(f, args, typename gens<sizeof...(Ts)>::type());
         }
+
+        /* Calls a function with an object followed by the elements of a tuple or array, without copying them */
+        template<typename R, typename Func, typename FirstT, typename TupleType, int ...S>
+        R spread(Func && f, FirstT & first, const TupleType & args, seq<S...>) {
+            return f(first, std::get<S>(args) ...);
+        }
     }
 }
 
@@ -32,12 +32,20 @@
 #define TWEENY_EASING_H
 
 #include <cmath>
+#include <algorithm>
+#include <ratio>
 #include <type_traits>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+#ifndef M_LN2
+#define M_LN2 0.69314718055994530942
+#endif
+
+#include "fastmath.h"
+
 /**
     * @defgroup easings Easings
     * @brief Bundled easing functions based on
@@ -126,6 +134,9 @@ namespace tweeny {
      * @code
      * auto tween = tweeny::from(0).to(100).via(tweeny::easing::linear);
      * @endcode
+     *
+     * Besides `run`, each bundled easing has a `velocity` function with the same arguments. It returns the analytic
+     * derivative of `run` with respect to `position`, which is what tween::velocity uses.
      */
     class easing {
         public:
@@ -177,9 +188,14 @@ namespace tweeny {
              */
             static constexpr struct steppedEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float, const T & start, const T &) {
                     return start;
                 }
+
+                template<typename T>
+                static T velocity(float, const T &, const T &) {
+                    return T();
+                }
             } stepped = steppedEasing{};
       
             /**
@@ -204,19 +220,29 @@ namespace tweeny {
 
 
                 template<typename T>
-                static typename std::enable_if<std::is_integral<T>::value, T>::type run(float position, T start, T end) {
+                static typename std::enable_if<std::is_integral<T>::value, T>::type run(float position, const T & start, const T & end) {
                     return static_cast<T>(roundf((end - start) * position + start));
                 }
 
                 template<typename T>
-                static typename std::enable_if<supports_arithmetic_operations<T>::value && !std::is_integral<T>::value, T>::type run(float position, T start, T end) {
+                static typename std::enable_if<supports_arithmetic_operations<T>::value && !std::is_integral<T>::value, T>::type run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position + start);
                 }
 
                 template<typename T>
-                static typename std::enable_if<!supports_arithmetic_operations<T>::value, T>::type run(float position, T start, T end) {
+                static typename std::enable_if<!supports_arithmetic_operations<T>::value, T>::type run(float position, const T & start, const T & end) {
                     return start;
                 }
+
+                template<typename T>
+                static typename std::enable_if<supports_arithmetic_operations<T>::value, T>::type velocity(float, const T & start, const T & end) {
+                    return static_cast<T>(end - start);
+                }
+
+                template<typename T>
+                static typename std::enable_if<!supports_arithmetic_operations<T>::value, T>::type velocity(float, const T &, const T &) {
+                    return T();
+                }
             } def = defaultEasing{};
 
             /**
@@ -225,14 +251,19 @@ namespace tweeny {
              */
             static constexpr struct linearEasing {
                 template<typename T>
-                static typename std::enable_if<std::is_integral<T>::value, T>::type run(float position, T start, T end) {
+                static typename std::enable_if<std::is_integral<T>::value, T>::type run(float position, const T & start, const T & end) {
                     return static_cast<T>(roundf((end - start) * position + start));
                 }
 
                 template<typename T>
-                static typename std::enable_if<!std::is_integral<T>::value, T>::type run(float position, T start, T end) {
+                static typename std::enable_if<!std::is_integral<T>::value, T>::type run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position + start);
                 }
+
+                template<typename T>
+                static T velocity(float, const T & start, const T & end) {
+                    return static_cast<T>(end - start);
+                }
             } linear = linearEasing{};
 
              /**
@@ -241,9 +272,14 @@ namespace tweeny {
               */
             static constexpr struct quadraticInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position * position + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (2 * position));
+                }
             } quadraticIn = quadraticInEasing{};
 
             /**
@@ -252,9 +288,14 @@ namespace tweeny {
               */
             static constexpr struct quadraticOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return static_cast<T>((-(end - start)) * position * (position - 2) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (2 * (1 - position)));
+                }
             } quadraticOut = quadraticOutEasing{};
 
             /**
@@ -263,7 +304,7 @@ namespace tweeny {
               */
             static constexpr struct quadraticInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
                         return static_cast<T>(((end - start) / 2) * position * position + start);
@@ -272,6 +313,17 @@ namespace tweeny {
                     --position;
                     return static_cast<T>((-(end - start) / 2) * (position * (position - 2) - 1) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position < 1) {
+                        return static_cast<T>((end - start) * (2 * position));
+                    }
+
+                    --position;
+                    return static_cast<T>((end - start) * (2 * (1 - position)));
+                }
             } quadraticInOut = quadraticInOutEasing{};
 
             /**
@@ -280,9 +332,14 @@ namespace tweeny {
               */
             static constexpr struct cubicInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position * position * position + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (3 * position * position));
+                }
             } cubicIn = cubicInEasing{};
 
             /**
@@ -291,10 +348,16 @@ namespace tweeny {
               */
             static constexpr struct cubicOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     --position;
                     return static_cast<T>((end - start) * (position * position * position + 1) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    --position;
+                    return static_cast<T>((end - start) * (3 * position * position));
+                }
             } cubicOut = cubicOutEasing{};
 
             /**
@@ -303,7 +366,7 @@ namespace tweeny {
               */
             static constexpr struct cubicInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
                         return static_cast<T>(((end - start) / 2) * position * position * position + start);
@@ -311,6 +374,13 @@ namespace tweeny {
                     position -= 2;
                     return static_cast<T>(((end - start) / 2) * (position * position * position + 2) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position >= 1) position -= 2;
+                    return static_cast<T>((end - start) * (3 * position * position));
+                }
             } cubicInOut = cubicInOutEasing{};
 
             /**
@@ -319,9 +389,14 @@ namespace tweeny {
               */
             static constexpr struct quarticInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position * position * position * position + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (4 * position * position * position));
+                }
             } quarticIn = quarticInEasing{};
 
             /**
@@ -330,10 +405,16 @@ namespace tweeny {
               */
             static constexpr struct quarticOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     --position;
                     return static_cast<T>( -(end - start) * (position * position * position * position - 1) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    --position;
+                    return static_cast<T>((end - start) * (-4 * position * position * position));
+                }
             } quarticOut = quarticOutEasing{};
 
             /**
@@ -342,7 +423,7 @@ namespace tweeny {
               */
             static constexpr struct quarticInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
                         return static_cast<T>(((end - start) / 2) * (position * position * position * position) +
@@ -352,6 +433,16 @@ namespace tweeny {
                     return static_cast<T>((-(end - start) / 2) * (position * position * position * position - 2) +
                                           start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position < 1) {
+                        return static_cast<T>((end - start) * (4 * position * position * position));
+                    }
+                    position -= 2;
+                    return static_cast<T>((end - start) * (-4 * position * position * position));
+                }
             } quarticInOut = quarticInOutEasing{};
 
             /**
@@ -360,9 +451,14 @@ namespace tweeny {
               */
             static constexpr struct quinticInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return static_cast<T>((end - start) * position * position * position * position * position + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (5 * position * position * position * position));
+                }
             } quinticIn = quinticInEasing{};
 
             /**
@@ -371,11 +467,17 @@ namespace tweeny {
               */
             static constexpr struct quinticOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     position--;
                     return static_cast<T>((end - start) * (position * position * position * position * position + 1) +
                                           start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    position--;
+                    return static_cast<T>((end - start) * (5 * position * position * position * position));
+                }
             } quinticOut = quinticOutEasing{};
 
             /**
@@ -384,7 +486,7 @@ namespace tweeny {
               */
             static constexpr struct quinticInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
                         return static_cast<T>(
@@ -396,6 +498,13 @@ namespace tweeny {
                         ((end - start) / 2) * (position * position * position * position * position + 2) +
                         start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position >= 1) position -= 2;
+                    return static_cast<T>((end - start) * (5 * position * position * position * position));
+                }
             } quinticInOut = quinticInOutEasing{};
 
             /**
@@ -403,9 +512,15 @@ namespace tweeny {
               * @brief Acceelerate initial values with a sinusoidal equation.
               */
             static constexpr struct sinusoidalInEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>(-(end - start) * cosf(position * static_cast<float>(M_PI) / 2) + (end - start) + start);
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>(-(end - start) * M::cos(position * static_cast<float>(M_PI) / 2) + (end - start) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    float w = static_cast<float>(M_PI) / 2;
+                    return static_cast<T>((end - start) * (w * M::sin(position * w)));
                 }
             } sinusoidalIn = sinusoidalInEasing{};
 
@@ -414,9 +529,15 @@ namespace tweeny {
               * @brief Deaccelerate ending values with a sinusoidal equation.
               */
             static constexpr struct sinusoidalOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>((end - start) * sinf(position * static_cast<float>(M_PI) / 2) + start);
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * M::sin(position * static_cast<float>(M_PI) / 2) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    float w = static_cast<float>(M_PI) / 2;
+                    return static_cast<T>((end - start) * (w * M::cos(position * w)));
                 }
             } sinusoidalOut = sinusoidalOutEasing{};
 
@@ -425,9 +546,15 @@ namespace tweeny {
               * @brief Acceelerate initial and deaccelerate ending values with a sinusoidal equation.
               */
             static constexpr struct sinusoidalInOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>((-(end - start) / 2) * (cosf(position * static_cast<float>(M_PI)) - 1) + start);
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>((-(end - start) / 2) * (M::cos(position * static_cast<float>(M_PI)) - 1) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    float w = static_cast<float>(M_PI);
+                    return static_cast<T>((end - start) * (w / 2 * M::sin(position * w)));
                 }
             } sinusoidalInOut = sinusoidalInOutEasing{};
 
@@ -436,9 +563,14 @@ namespace tweeny {
               * @brief Acceelerate initial values with an exponential equation.
               */
             static constexpr struct exponentialInEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>((end - start) * powf(2, 10 * (position - 1)) + start);
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * M::exp2(10 * (position - 1)) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (10 * static_cast<float>(M_LN2) * M::exp2(10 * (position - 1))));
                 }
             } exponentialIn = exponentialInEasing{};
 
@@ -447,9 +579,14 @@ namespace tweeny {
               * @brief Deaccelerate ending values with an exponential equation.
               */
             static constexpr struct exponentialOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>((end - start) * (-powf(2, -10 * position) + 1) + start);
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (-M::exp2(-10 * position) + 1) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (10 * static_cast<float>(M_LN2) * M::exp2(-10 * position)));
                 }
             } exponentialOut = exponentialOutEasing{};
 
@@ -458,14 +595,24 @@ namespace tweeny {
               * @brief Acceelerate initial and deaccelerate ending values with an exponential equation.
               */
             static constexpr struct exponentialInOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position < 1) {
+                        return static_cast<T>(((end - start) / 2) * M::exp2(10 * (position - 1)) + start);
+                    }
+                    --position;
+                    return static_cast<T>(((end - start) / 2) * (-M::exp2(-10 * position) + 2) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
-                        return static_cast<T>(((end - start) / 2) * powf(2, 10 * (position - 1)) + start);
+                        return static_cast<T>((end - start) * (10 * static_cast<float>(M_LN2) * M::exp2(10 * (position - 1))));
                     }
                     --position;
-                    return static_cast<T>(((end - start) / 2) * (-powf(2, -10 * position) + 2) + start);
+                    return static_cast<T>((end - start) * (10 * static_cast<float>(M_LN2) * M::exp2(-10 * position)));
                 }
             } exponentialInOut = exponentialInOutEasing{};
 
@@ -474,9 +621,14 @@ namespace tweeny {
               * @brief Acceelerate initial values with a circular equation.
               */
             static constexpr struct circularInEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
-                    return static_cast<T>( -(end - start) * (sqrtf(1 - position * position) - 1) + start );
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    return static_cast<T>( -(end - start) * (M::sqrt(1 - position * position) - 1) + start );
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>((end - start) * (position / M::sqrt(std::max(1 - position * position, 1e-6f))));
                 }
             } circularIn = circularInEasing{};
 
@@ -485,10 +637,16 @@ namespace tweeny {
               * @brief Deaccelerate ending values with a circular equation.
               */
             static constexpr struct circularOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    --position;
+                    return static_cast<T>((end - start) * (M::sqrt(1 - position * position)) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
                     --position;
-                    return static_cast<T>((end - start) * (sqrtf(1 - position * position)) + start);
+                    return static_cast<T>((end - start) * (-position / M::sqrt(std::max(1 - position * position, 1e-6f))));
                 }
             } circularOut = circularOutEasing{};
 
@@ -497,15 +655,26 @@ namespace tweeny {
               * @brief Acceelerate initial and deaccelerate ending values with a circular equation.
               */
             static constexpr struct circularInOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
+                    position *= 2;
+                    if (position < 1) {
+                        return static_cast<T>((-(end - start) / 2) * (M::sqrt(1 - position * position) - 1) + start);
+                    }
+
+                    position -= 2;
+                    return static_cast<T>(((end - start) / 2) * (M::sqrt(1 - position * position) + 1) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
                     position *= 2;
                     if (position < 1) {
-                        return static_cast<T>((-(end - start) / 2) * (sqrtf(1 - position * position) - 1) + start);
+                        return static_cast<T>((end - start) * (position / M::sqrt(std::max(1 - position * position, 1e-6f))));
                     }
 
                     position -= 2;
-                    return static_cast<T>(((end - start) / 2) * (sqrtf(1 - position * position) + 1) + start);
+                    return static_cast<T>((end - start) * (-position / M::sqrt(std::max(1 - position * position, 1e-6f))));
                 }
             } circularInOut = circularInOutEasing{};
 
@@ -515,9 +684,14 @@ namespace tweeny {
               */
             static constexpr struct bounceInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     return (end - start) - bounceOut.run((1 - position), T(), (end - start)) + start;
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return bounceOut.velocity(1 - position, start, end);
+                }
             } bounceIn = bounceInEasing{};
 
             /**
@@ -526,7 +700,7 @@ namespace tweeny {
               */
             static constexpr struct bounceOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     T c = end - start;
                     if (position < (1 / 2.75f)) {
                         return static_cast<T>(c * (7.5625f * position * position) + start);
@@ -541,6 +715,14 @@ namespace tweeny {
                         return static_cast<T>(c * (7.5625f * (postFix) * position + .984375f) + start);
                     }
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    if (position >= (2.5f / 2.75f)) position -= (2.625f / 2.75f);
+                    else if (position >= (2.0f / 2.75f)) position -= (2.25f / 2.75f);
+                    else if (position >= (1 / 2.75f)) position -= (1.5f / 2.75f);
+                    return static_cast<T>((end - start) * (2 * 7.5625f * position));
+                }
             } bounceOut = bounceOutEasing{};
 
             /**
@@ -549,10 +731,16 @@ namespace tweeny {
             */
             static constexpr struct bounceInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     if (position < 0.5f) return static_cast<T>(bounceIn.run(position * 2, T(), (end - start)) * .5f + start);
                     else return static_cast<T>(bounceOut.run((position * 2 - 1), T(), (end - start)) * .5f + (end - start) * .5f + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    if (position < 0.5f) return bounceIn.velocity(position * 2, start, end);
+                    else return bounceOut.velocity(position * 2 - 1, start, end);
+                }
             } bounceInOut = bounceInOutEasing{};
 
             /**
@@ -560,16 +748,28 @@ namespace tweeny {
               * @brief Acceelerate initial values with an "elastic" equation.
               */
             static constexpr struct elasticInEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
                     if (position <= 0.00001f) return start;
                     if (position >= 0.999f) return end;
                     float p = .3f;
                     auto a = end - start;
                     float s = p / 4;
                     float postFix =
-                        a * powf(2, 10 * (position -= 1)); // this is a fix, again, with post-increment operators
-                    return static_cast<T>(-(postFix * sinf((position - s) * (2 * static_cast<float>(M_PI)) / p)) + start);
+                        a * M::exp2(10 * (position -= 1)); // this is a fix, again, with post-increment operators
+                    return static_cast<T>(-(postFix * M::sin((position - s) * (2 * static_cast<float>(M_PI)) / p)) + start);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    if (position <= 0.00001f || position >= 0.999f) return static_cast<T>((end - start) * 0.0f);
+                    float p = .3f;
+                    float s = p / 4;
+                    float w = 2 * static_cast<float>(M_PI) / p;
+                    position -= 1;
+                    float e = M::exp2(10 * position);
+                    float a = (position - s) * w;
+                    return static_cast<T>((end - start) * (-e * (10 * static_cast<float>(M_LN2) * M::sin(a) + w * M::cos(a))));
                 }
             } elasticIn = elasticInEasing{};
 
@@ -578,14 +778,25 @@ namespace tweeny {
               * @brief Deaccelerate ending values with an "elastic" equation.
               */
             static constexpr struct elasticOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
                     if (position <= 0.00001f) return start;
                     if (position >= 0.999f) return end;
                     float p = .3f;
                     auto a = end - start;
                     float s = p / 4;
-                    return static_cast<T>(a * powf(2, -10 * position) * sinf((position - s) * (2 * static_cast<float>(M_PI)) / p) + end);
+                    return static_cast<T>(a * M::exp2(-10 * position) * M::sin((position - s) * (2 * static_cast<float>(M_PI)) / p) + end);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    if (position <= 0.00001f || position >= 0.999f) return static_cast<T>((end - start) * 0.0f);
+                    float p = .3f;
+                    float s = p / 4;
+                    float w = 2 * static_cast<float>(M_PI) / p;
+                    float e = M::exp2(-10 * position);
+                    float a = (position - s) * w;
+                    return static_cast<T>((end - start) * (e * (w * M::cos(a) - 10 * static_cast<float>(M_LN2) * M::sin(a))));
                 }
             } elasticOut = elasticOutEasing{};
 
@@ -594,8 +805,8 @@ namespace tweeny {
             * @brief Acceelerate initial and deaccelerate ending values with an "elastic" equation.
             */
             static constexpr struct elasticInOutEasing {
-                template<typename T>
-                static T run(float position, T start, T end) {
+                template<typename T, typename M = detail::math>
+                static T run(float position, const T & start, const T & end) {
                     if (position <= 0.00001f) return start;
                     if (position >= 0.999f) return end;
                     position *= 2;
@@ -605,11 +816,29 @@ namespace tweeny {
                     float postFix;
 
                     if (position < 1) {
-                        postFix = a * powf(2, 10 * (position -= 1)); // postIncrement is evil
-                        return static_cast<T>(-0.5f * (postFix * sinf((position - s) * (2 * static_cast<float>(M_PI)) / p)) + start);
+                        postFix = a * M::exp2(10 * (position -= 1)); // postIncrement is evil
+                        return static_cast<T>(-0.5f * (postFix * M::sin((position - s) * (2 * static_cast<float>(M_PI)) / p)) + start);
+                    }
+                    postFix = a * M::exp2(-10 * (position -= 1)); // postIncrement is evil
+                    return static_cast<T>(postFix * M::sin((position - s) * (2 * static_cast<float>(M_PI)) / p) * .5f + end);
+                }
+
+                template<typename T, typename M = detail::math>
+                static T velocity(float position, const T & start, const T & end) {
+                    if (position <= 0.00001f || position >= 0.999f) return static_cast<T>((end - start) * 0.0f);
+                    position *= 2;
+                    float p = (.3f * 1.5f);
+                    float s = p / 4;
+                    float w = 2 * static_cast<float>(M_PI) / p;
+                    bool in = position < 1;
+                    position -= 1;
+                    float a = (position - s) * w;
+                    if (in) {
+                        float e = M::exp2(10 * position);
+                        return static_cast<T>((end - start) * (-e * (10 * static_cast<float>(M_LN2) * M::sin(a) + w * M::cos(a))));
                     }
-                    postFix = a * powf(2, -10 * (position -= 1)); // postIncrement is evil
-                    return static_cast<T>(postFix * sinf((position - s) * (2 * static_cast<float>(M_PI)) / p) * .5f + end);
+                    float e = M::exp2(-10 * position);
+                    return static_cast<T>((end - start) * (e * (w * M::cos(a) - 10 * static_cast<float>(M_LN2) * M::sin(a))));
                 }
             } elasticInOut = elasticInOutEasing{};
 
@@ -619,11 +848,17 @@ namespace tweeny {
               */
             static constexpr struct backInEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     float s = 1.70158f;
                     float postFix = position;
                     return static_cast<T>((end - start) * (postFix) * position * ((s + 1) * position - s) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    float s = 1.70158f;
+                    return static_cast<T>((end - start) * (3 * (s + 1) * position * position - 2 * s * position));
+                }
             } backIn = backInEasing{};
 
             /**
@@ -632,11 +867,18 @@ namespace tweeny {
               */
             static constexpr struct backOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     float s = 1.70158f;
                     position -= 1;
                     return static_cast<T>((end - start) * ((position) * position * ((s + 1) * position + s) + 1) + start);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    float s = 1.70158f;
+                    position -= 1;
+                    return static_cast<T>((end - start) * (3 * (s + 1) * position * position + 2 * s * position));
+                }
             } backOut = backOutEasing{};
 
             /**
@@ -645,7 +887,7 @@ namespace tweeny {
             */
             static constexpr struct backInOutEasing {
                 template<typename T>
-                static T run(float position, T start, T end) {
+                static T run(float position, const T & start, const T & end) {
                     float s = 1.70158f;
                     float t = position;
                     auto b = start;
@@ -656,7 +898,163 @@ namespace tweeny {
                     float postFix = t -= 2;
                     return static_cast<T>(c / 2 * ((postFix) * t * (((s) + 1) * t + s) + 2) + b);
                 }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    float s = 1.70158f * 1.525f;
+                    float t = position * 2;
+                    if (t < 1) return static_cast<T>((end - start) * (3 * (s + 1) * t * t - 2 * s * t));
+                    t -= 2;
+                    return static_cast<T>((end - start) * (3 * (s + 1) * t * t + 2 * s * t));
+                }
             } backInOut = backInOutEasing{};
+
+            /**
+             * @brief Approximate versions of the sinusoidal, exponential and elastic easings.
+             *
+             * They compute sines, cosines and powers of two with polynomials instead of calling the C library, and
+             * stay within 1e-5 of the tweened range from the bundled easings. How much faster they are depends on the
+             * C library and on inlining: the `tweeny-easing-benchmark` target measures it. Use them like any other
+             * easing. To make every bundled easing use them instead, define `TWEENY_FAST_MATH` before including tweeny.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto tween = tweeny::from(0.0f).to(1.0f).during(100).via(tweeny::easing::fast::sinusoidalInOut);
+             * @endcode
+             */
+            struct fast {
+                static constexpr detail::approximated<sinusoidalInEasing> sinusoidalIn = {}; ///< @sa easing::sinusoidalIn
+                static constexpr detail::approximated<sinusoidalOutEasing> sinusoidalOut = {}; ///< @sa easing::sinusoidalOut
+                static constexpr detail::approximated<sinusoidalInOutEasing> sinusoidalInOut = {}; ///< @sa easing::sinusoidalInOut
+                static constexpr detail::approximated<exponentialInEasing> exponentialIn = {}; ///< @sa easing::exponentialIn
+                static constexpr detail::approximated<exponentialOutEasing> exponentialOut = {}; ///< @sa easing::exponentialOut
+                static constexpr detail::approximated<exponentialInOutEasing> exponentialInOut = {}; ///< @sa easing::exponentialInOut
+                static constexpr detail::approximated<elasticInEasing> elasticIn = {}; ///< @sa easing::elasticIn
+                static constexpr detail::approximated<elasticOutEasing> elasticOut = {}; ///< @sa easing::elasticOut
+                static constexpr detail::approximated<elasticInOutEasing> elasticInOut = {}; ///< @sa easing::elasticInOut
+            };
+
+            /**
+             * @brief Plays an easing backwards, turning an "in" easing into its "out" counterpart and vice versa.
+             *
+             * Combinators like this one are types, composed at compile time, so that the resulting easing is as cheap
+             * as a bundled one. Pass an instance of it to tween::via:
+             *
+             * @code
+             * using tweeny::easing;
+             * auto tween = tweeny::from(0.0f).to(1.0f).during(100).via(easing::reverse<easing::bounceInEasing>());
+             * @endcode
+             *
+             * @tparam EasingT A bundled easing type, like easing::quadraticInEasing, or another combinator
+             * @sa mirror, chain, blend
+             */
+            template<typename EasingT>
+            struct reverse {
+                template<typename T>
+                static T run(float position, const T & start, const T & end) {
+                    return EasingT::template run<T>(1 - position, end, start);
+                }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return static_cast<T>(EasingT::template velocity<T>(1 - position, end, start) * -1.0f);
+                }
+            };
+
+            /**
+             * @brief Plays two easings one after the other, each over part of the duration and of the distance.
+             *
+             * The first easing covers the first @p SplitT of both, and the second easing the rest.
+             *
+             * @tparam FirstT The easing played first
+             * @tparam SecondT The easing played last
+             * @tparam SplitT A std::ratio between 0 and 1, one half by default
+             * @sa reverse
+             */
+            template<typename FirstT, typename SecondT, typename SplitT = std::ratio<1, 2>>
+            struct chain {
+                template<typename T>
+                static T run(float position, const T & start, const T & end) {
+                    const float split = static_cast<float>(SplitT::num) / SplitT::den;
+                    T middle = static_cast<T>(start + (end - start) * split);
+                    if (position < split) return FirstT::template run<T>(position / split, start, middle);
+                    return SecondT::template run<T>((position - split) / (1 - split), middle, end);
+                }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    const float split = static_cast<float>(SplitT::num) / SplitT::den;
+                    T middle = static_cast<T>(start + (end - start) * split);
+                    if (position < split) return static_cast<T>(FirstT::template velocity<T>(position / split, start, middle) / split);
+                    return static_cast<T>(SecondT::template velocity<T>((position - split) / (1 - split), middle, end) / (1 - split));
+                }
+            };
+
+            /**
+             * @brief Plays an easing over the first half, and backwards over the second, like the "in-out" easings.
+             *
+             * For instance, `mirror<quadraticInEasing>` is quadraticInOut and `mirror<bounceOutEasing>` bounces at
+             * both ends.
+             *
+             * @tparam EasingT The easing of the first half
+             * @sa chain, reverse
+             */
+            template<typename EasingT>
+            using mirror = chain<EasingT, reverse<EasingT>>;
+
+            /**
+             * @brief Mixes two easings, weighting the second by @p WeightT.
+             *
+             * @tparam FirstT An easing
+             * @tparam SecondT Another easing
+             * @tparam WeightT A std::ratio between 0 and 1, one half by default
+             */
+            template<typename FirstT, typename SecondT, typename WeightT = std::ratio<1, 2>>
+            struct blend {
+                template<typename T>
+                static T run(float position, const T & start, const T & end) {
+                    const float weight = static_cast<float>(WeightT::num) / WeightT::den;
+                    return static_cast<T>(FirstT::template run<T>(position, start, end) * (1 - weight)
+                                        + SecondT::template run<T>(position, start, end) * weight);
+                }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    const float weight = static_cast<float>(WeightT::num) / WeightT::den;
+                    return static_cast<T>(FirstT::template velocity<T>(position, start, end) * (1 - weight)
+                                        + SecondT::template velocity<T>(position, start, end) * weight);
+                }
+            };
+
+            /**
+             * @brief Blends tweeny::rgba colors in linear light instead of sRGB, like renderers do.
+             *
+             * Blending sRGB colors as they are stored makes transitions between saturated colors go through darker
+             * tones. This combinator converts colors to linear light and back with lookup tables, at a small cost.
+             * Alpha is blended as it is, and other value types are eased by @p EasingT unchanged.
+             *
+             * @code
+             * using tweeny::easing;
+             * auto fade = tweeny::from(tweeny::rgba(0xff0000ff)).to(tweeny::rgba(0x00ff00ff)).during(500)
+             *                    .via(easing::linearLight<easing::quadraticInOutEasing>());
+             * @endcode
+             *
+             * @tparam EasingT An easing
+             * @sa tweeny::rgba
+             */
+            template<typename EasingT>
+            struct linearLight {
+                template<typename T>
+                static T run(float position, const T & start, const T & end) {
+                    return EasingT::template run<T>(position, start, end);
+                }
+
+                template<typename T>
+                static T velocity(float position, const T & start, const T & end) {
+                    return EasingT::template velocity<T>(position, start, end);
+                }
+            };
     };
 }
 #endif //TWEENY_EASING_H
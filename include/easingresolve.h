@@ -32,84 +32,204 @@
 #define TWEENY_EASINGRESOLVE_H
 
 #include <tuple>
+#include <algorithm>
+#include <type_traits>
 #include "easing.h"
+#include "polynomial.h"
+#include "tweentraits.h"
 
 namespace tweeny {
     namespace detail {
         using std::get;
 
-        template<int I, typename TypeTuple, typename FunctionTuple, typename... Fs>
+        /* Multiplies a value by a factor, leaving non-arithmetic values untouched */
+        template<typename T>
+        typename std::enable_if<easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type scale(const T & v, float f) {
+            return static_cast<T>(v * f);
+        }
+
+        template<typename T>
+        typename std::enable_if<!easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type scale(const T & v, float) {
+            return v;
+        }
+
+        /* Adds a bump, height * t(1 - t)², which keeps both ends of a segment in place but changes its starting
+         * velocity by height */
+        template<typename T>
+        typename std::enable_if<easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type bump(const T & v, const typename ratetype<T>::type & height, float t) {
+            return static_cast<T>(v + height * (t * (1 - t) * (1 - t)));
+        }
+
+        template<typename T>
+        typename std::enable_if<!easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type bump(const T & v, const typename ratetype<T>::type &, float) {
+            return v;
+        }
+
+        /* Returns the derivative of detail::bump */
+        template<typename T>
+        typename std::enable_if<easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type bumpSlope(const T & v, const T & height, float t) {
+            return static_cast<T>(v + height * ((1 - t) * (1 - 3 * t)));
+        }
+
+        template<typename T>
+        typename std::enable_if<!easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type bumpSlope(const T & v, const T &, float) {
+            return v;
+        }
+
+        /* Returns the bump height that makes a segment of some duration start at a velocity, given the slope its
+         * easing starts with */
+        template<typename T>
+        typename std::enable_if<easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type lift(const T & velocity, float duration, const T & slope) {
+            return static_cast<T>(velocity * duration - slope);
+        }
+
+        template<typename T>
+        typename std::enable_if<!easing::defaultEasing::supports_arithmetic_operations<T>::value, T>::type lift(const T &, float, const T & slope) {
+            return slope;
+        }
+
+        /* Approximates the velocity of an user-supplied easing by a central difference */
+        template<typename T, typename F>
+        struct slope {
+            typedef typename ratetype<T>::type R;
+            F f;
+
+            template<typename U = T>
+            typename std::enable_if<easing::defaultEasing::supports_arithmetic_operations<U>::value, R>::type operator()(float position, const T & start, const T & end) const {
+                float low = std::max(0.0f, position - 1e-3f);
+                float high = std::min(1.0f, position + 1e-3f);
+                return static_cast<R>((f(high, start, end) - f(low, start, end)) * (1.0f / (high - low)));
+            }
+
+            template<typename U = T>
+            typename std::enable_if<!easing::defaultEasing::supports_arithmetic_operations<U>::value, R>::type operator()(float, const T &, const T &) const {
+                return R();
+            }
+        };
+
+        /* The functions of a bundled easing for a value type. Tween points refer to them instead of holding copies */
+        template<typename T>
+        struct curve {
+            T (*run)(float, const T &, const T &);
+            typename ratetype<T>::type (*velocity)(float, const T &, const T &);
+            const polynomial * shape; // nullptr unless the easing is a polynomial, see tween::fixed
+        };
+
+        /* Differentiates a bundled easing. Integers are differentiated as floats, see detail::ratetype */
+        template<typename EasingT, typename T, bool = std::is_integral<T>::value>
+        struct rateof {
+            static T velocity(float position, const T & start, const T & end) {
+                return EasingT::template velocity<T>(position, start, end);
+            }
+        };
+
+        template<typename EasingT, typename T>
+        struct rateof<EasingT, T, true> {
+            static float velocity(float position, const T & start, const T & end) {
+                return EasingT::template velocity<float>(position, static_cast<float>(start), static_cast<float>(end));
+            }
+        };
+
+        /* The curve of each bundled easing is only instantiated for the value types it is used with */
+        template<typename EasingT, typename T>
+        struct curveof {
+            static const curve<T> value;
+        };
+
+        template<typename EasingT, typename T>
+        const curve<T> curveof<EasingT, T>::value = {
+            &EasingT::template run<T>, &rateof<EasingT, T>::velocity, polynomialof<EasingT>::value
+        };
+
+        template<int I, typename TypeTuple, typename PointT, typename... Fs>
         struct easingresolve {
-            static void impl(FunctionTuple &b, Fs... fs) {
+            static void impl(PointT &p, Fs... fs) {
                 if (sizeof...(Fs) == 0) return;
-                easingresolve<I, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...);
+                easingresolve<I, TypeTuple, PointT, Fs...>::impl(p, fs...);
             }
         };
 
-        template<int I, typename TypeTuple, typename FunctionTuple, typename F1, typename... Fs>
-        struct easingresolve<I, TypeTuple, FunctionTuple, F1, Fs...> {
-            static void impl(FunctionTuple &b, F1 f1, Fs... fs) {
-                get<I>(b) = f1;
-                easingresolve<I + 1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...);
+        template<int I, typename TypeTuple, typename PointT, typename F1, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, F1, Fs...> {
+            typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
+
+            static void impl(PointT &p, F1 f1, Fs... fs) {
+                auto & c = p.callables();
+                get<I>(c.easings) = f1;
+                get<I>(c.velocities) = slope<ArgType, F1>{f1};
+                get<I>(p.curves) = nullptr;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
             }
         };
 
-        template<int I, typename TypeTuple, typename FunctionTuple, typename... Fs>
-        struct easingresolve<I, TypeTuple, FunctionTuple, easing::steppedEasing, Fs...> {
+        #define DECLARE_BUNDLED_RESOLVE(__EASING_STRUCT__) \
+        template <int I, typename TypeTuple, typename PointT, typename... Fs> \
+        struct easingresolve<I, TypeTuple, PointT, easing::__EASING_STRUCT__, Fs...> { \
+          typedef typename std::tuple_element<I, TypeTuple>::type ArgType; \
+          static void impl(PointT & p, easing::__EASING_STRUCT__, Fs... fs) { \
+            get<I>(p.curves) = &curveof<easing::__EASING_STRUCT__, ArgType>::value; \
+            easingresolve<I+1, TypeTuple, PointT, Fs...>::impl(p, fs...); \
+          } \
+        }
+
+        template <int I, typename TypeTuple, typename PointT, typename EasingT, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, approximated<EasingT>, Fs...> {
             typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
 
-            static void impl(FunctionTuple &b, easing::steppedEasing, Fs... fs) {
-                get<I>(b) = easing::stepped.run<ArgType>;
-                easingresolve<I + 1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...);
+            static void impl(PointT & p, approximated<EasingT>, Fs... fs) {
+                get<I>(p.curves) = &curveof<approximated<EasingT>, ArgType>::value;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
             }
         };
 
-        template<int I, typename TypeTuple, typename FunctionTuple, typename... Fs>
-        struct easingresolve<I, TypeTuple, FunctionTuple, easing::linearEasing, Fs...> {
+        template <int I, typename TypeTuple, typename PointT, typename EasingT, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, easing::reverse<EasingT>, Fs...> {
             typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
 
-            static void impl(FunctionTuple &b, easing::linearEasing, Fs... fs) {
-                get<I>(b) = easing::linear.run<ArgType>;
-                easingresolve<I + 1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...);
+            static void impl(PointT & p, easing::reverse<EasingT>, Fs... fs) {
+                get<I>(p.curves) = &curveof<easing::reverse<EasingT>, ArgType>::value;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
             }
         };
-        template<int I, typename TypeTuple, typename FunctionTuple, typename... Fs>
-        struct easingresolve<I, TypeTuple, FunctionTuple, easing::defaultEasing, Fs...> {
+
+        template <int I, typename TypeTuple, typename PointT, typename FirstT, typename SecondT, typename SplitT, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, easing::chain<FirstT, SecondT, SplitT>, Fs...> {
             typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
 
-            static void impl(FunctionTuple &b, easing::defaultEasing, Fs... fs) {
-                get<I>(b) = easing::def.run<ArgType>;
-                easingresolve<I + 1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...);
+            static void impl(PointT & p, easing::chain<FirstT, SecondT, SplitT>, Fs... fs) {
+                get<I>(p.curves) = &curveof<easing::chain<FirstT, SecondT, SplitT>, ArgType>::value;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
+            }
+        };
+
+        template <int I, typename TypeTuple, typename PointT, typename FirstT, typename SecondT, typename WeightT, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, easing::blend<FirstT, SecondT, WeightT>, Fs...> {
+            typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
+
+            static void impl(PointT & p, easing::blend<FirstT, SecondT, WeightT>, Fs... fs) {
+                get<I>(p.curves) = &curveof<easing::blend<FirstT, SecondT, WeightT>, ArgType>::value;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
+            }
+        };
+
+        template <int I, typename TypeTuple, typename PointT, typename EasingT, typename... Fs>
+        struct easingresolve<I, TypeTuple, PointT, easing::linearLight<EasingT>, Fs...> {
+            typedef typename std::tuple_element<I, TypeTuple>::type ArgType;
+
+            static void impl(PointT & p, easing::linearLight<EasingT>, Fs... fs) {
+                get<I>(p.curves) = &curveof<easing::linearLight<EasingT>, ArgType>::value;
+                easingresolve<I + 1, TypeTuple, PointT, Fs...>::impl(p, fs...);
             }
         };
 
         #define DECLARE_EASING_RESOLVE(__EASING_TYPE__) \
-        template <int I, typename TypeTuple, typename FunctionTuple, typename... Fs> \
-        struct easingresolve<I, TypeTuple, FunctionTuple, easing::__EASING_TYPE__ ## InEasing, Fs...> { \
-          typedef typename std::tuple_element<I, TypeTuple>::type ArgType; \
-          static void impl(FunctionTuple & b, decltype(easing::__EASING_TYPE__ ## In), Fs... fs) { \
-            get<I>(b) = easing::__EASING_TYPE__ ## In.run<ArgType>; \
-            easingresolve<I+1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...); \
-          } \
-        }; \
-        \
-        template <int I, typename TypeTuple, typename FunctionTuple, typename... Fs> \
-          struct easingresolve<I, TypeTuple, FunctionTuple, easing::__EASING_TYPE__ ## OutEasing, Fs...> { \
-          typedef typename std::tuple_element<I, TypeTuple>::type ArgType; \
-          static void impl(FunctionTuple & b, decltype(easing::__EASING_TYPE__ ## Out), Fs... fs) { \
-            get<I>(b) = easing::__EASING_TYPE__ ## Out.run<ArgType>; \
-            easingresolve<I+1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...); \
-          } \
-        }; \
-        \
-        template <int I, typename TypeTuple, typename FunctionTuple, typename... Fs> \
-          struct easingresolve<I, TypeTuple, FunctionTuple, easing::__EASING_TYPE__ ## InOutEasing, Fs...> { \
-          typedef typename std::tuple_element<I, TypeTuple>::type ArgType; \
-          static void impl(FunctionTuple & b, decltype(easing::__EASING_TYPE__ ## InOut), Fs... fs) { \
-            get<I>(b) = easing::__EASING_TYPE__ ## InOut.run<ArgType>; \
-            easingresolve<I+1, TypeTuple, FunctionTuple, Fs...>::impl(b, fs...); \
-          } \
-        }
+        DECLARE_BUNDLED_RESOLVE(__EASING_TYPE__ ## InEasing); \
+        DECLARE_BUNDLED_RESOLVE(__EASING_TYPE__ ## OutEasing); \
+        DECLARE_BUNDLED_RESOLVE(__EASING_TYPE__ ## InOutEasing)
+
+        DECLARE_BUNDLED_RESOLVE(steppedEasing);
+        DECLARE_BUNDLED_RESOLVE(linearEasing);
+        DECLARE_BUNDLED_RESOLVE(defaultEasing);
 
         DECLARE_EASING_RESOLVE(quadratic);
         DECLARE_EASING_RESOLVE(cubic);
@@ -0,0 +1,118 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * This file provides the math functions used by the bundled easings: the ones from the C library, and faster
+ * polynomial approximations of them, selected by easing::fast or by defining TWEENY_FAST_MATH.
+ * This file is private.
+ */
+
+#ifndef TWEENY_FASTMATH_H
+#define TWEENY_FASTMATH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace tweeny {
+    namespace detail {
+        /* The math functions of the C library */
+        struct precisemath {
+            static float sin(float x) { return sinf(x); }
+            static float cos(float x) { return cosf(x); }
+            static float exp2(float x) { return powf(2, x); }
+            static float sqrt(float x) { return sqrtf(x); }
+        };
+
+        /*
+         * Minimax polynomial approximations of the math functions used by easings. The absolute error of sin and cos
+         * is below 1e-6 over [-pi, pi] and below 2e-6 over [-20, 20], growing with the argument. The relative error of
+         * exp2 is below 4e-6. They are branchless, so that loops calling them can be vectorized. sqrt is left to the C
+         * library, as it is a single instruction on most CPUs.
+         */
+        struct fastmath {
+            /* Rounds to the nearest integer, as std::round would, for values that fit in an int32_t */
+            static float nearest(float x) {
+                return static_cast<float>(static_cast<int32_t>(x + std::copysign(0.5f, x)));
+            }
+
+            static float sin(float x) {
+                const float pi = static_cast<float>(M_PI);
+                float shifted = x * (1 / pi) + 12582912.0f; // adding 1.5 * 2^23 rounds to an integer, in the low bits
+                int32_t k;
+                std::memcpy(&k, &shifted, sizeof(k));
+                k -= 0x4b400000; // subtracts the bits of 1.5 * 2^23, which -ffast-math cannot fold away like a float
+                float a = x - static_cast<float>(k) * pi; // x - k * pi, in [-pi/2, pi/2] where the polynomial is fit
+                float a2 = a * a;
+                float s = a * (0.99999660f + a2 * (-0.16664828f + a2 * (0.0083063254f + a2 * -0.00018363663f)));
+                uint32_t bits;
+                std::memcpy(&bits, &s, sizeof(s));
+                bits ^= static_cast<uint32_t>(k & 1) << 31; // sin(a + k * pi) = (-1)^k * sin(a)
+                std::memcpy(&s, &bits, sizeof(s));
+                return s;
+            }
+
+            static float cos(float x) {
+                return sin(x + static_cast<float>(M_PI) / 2);
+            }
+
+            static float exp2(float x) {
+                x = std::min(std::max(x, -126.0f), 127.0f);
+                float whole = nearest(x - 0.5f); // floor, as x - whole must be in [0, 1]
+                float f = x - whole;
+                float p = 1.0000037f + f * (0.69296610f + f * (0.24163844f + f * (0.051690374f + f * 0.013697657f)));
+                int32_t bits;
+                std::memcpy(&bits, &p, sizeof(p));
+                bits += static_cast<int32_t>(whole) * (1 << 23); // multiplies by 2^whole by adding to the exponent
+                std::memcpy(&p, &bits, sizeof(p));
+                return p;
+            }
+
+            static float sqrt(float x) { return sqrtf(x); }
+        };
+
+#ifdef TWEENY_FAST_MATH
+        typedef fastmath math;
+#else
+        typedef precisemath math;
+#endif
+
+        /* An easing computed with fastmath, regardless of TWEENY_FAST_MATH */
+        template<typename EasingT>
+        struct approximated {
+            template<typename T>
+            static T run(float position, const T & start, const T & end) {
+                return EasingT::template run<T, fastmath>(position, start, end);
+            }
+
+            template<typename T>
+            static T velocity(float position, const T & start, const T & end) {
+                return EasingT::template velocity<T, fastmath>(position, start, end);
+            }
+        };
+    }
+}
+
+#endif //TWEENY_FASTMATH_H
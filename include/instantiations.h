@@ -0,0 +1,62 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file instantiations.h
+ * This file lists the tween types that are compiled once by the `tweeny-instantiations` library.
+ *
+ * Linking to `tweeny-instantiations` defines `TWEENY_EXTERN_TEMPLATES`, which makes this file declare these types as
+ * extern templates: translation units using them stop instantiating their members and use the ones compiled in the
+ * library instead. Types that are not listed here keep working as usual.
+ */
+
+#ifndef TWEENY_INSTANTIATIONS_H
+#define TWEENY_INSTANTIATIONS_H
+
+#include "tween.h"
+#include "collection.h"
+
+/* Calls X with each list of value types compiled by the tweeny-instantiations library */
+#define TWEENY_COMMON_TYPES(X) \
+    X(float) \
+    X(double) \
+    X(int) \
+    X(float, float) \
+    X(float, float, float) \
+    X(float, float, float, float)
+
+#ifdef TWEENY_EXTERN_TEMPLATES
+#define TWEENY_EXTERN_TEMPLATE(...) \
+    extern template struct detail::tweenpoint<__VA_ARGS__>; \
+    extern template class tween<__VA_ARGS__>; \
+    extern template class collection<__VA_ARGS__>;
+
+namespace tweeny {
+    TWEENY_COMMON_TYPES(TWEENY_EXTERN_TEMPLATE)
+}
+
+#undef TWEENY_EXTERN_TEMPLATE
+#endif
+
+#endif //TWEENY_INSTANTIATIONS_H
@@ -0,0 +1,219 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file mixer.h
+ * This file declares tweeny::mixer, which blends the values of several tweens by weight.
+ */
+
+#ifndef TWEENY_MIXER_H
+#define TWEENY_MIXER_H
+
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "tween.h"
+#include "int2type.h"
+
+namespace tweeny {
+    namespace detail {
+        /* A layer that takes part in a mix, with its weight divided by the total */
+        struct portion {
+            size_t layer;
+            float weight;
+        };
+
+        /* The value at an index of the values of a tween, which are not a tuple for single value tweens */
+        template<size_t I, typename V>
+        auto valueAt(V & values, std::false_type) -> decltype(std::get<I>(values)) { return std::get<I>(values); }
+
+        template<size_t I, typename V>
+        V & valueAt(V & values, std::true_type) { return values; }
+
+        /* Sums weighted values, in double precision for arithmetic types */
+        template<typename T, typename = void>
+        struct accumulator {
+            const T * heaviest = nullptr; // values that cannot be weighed are taken from the heaviest layer
+            float most = 0;
+
+            void add(const T & v, float w) { if (!heaviest || w > most) { heaviest = &v; most = w; } }
+            T result() const { return *heaviest; }
+        };
+
+        template<typename T>
+        struct accumulator<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+            double sum = 0;
+
+            void add(const T & v, float w) { sum += static_cast<double>(v) * w; }
+            T result() const { return static_cast<T>(std::is_integral<T>::value ? std::round(sum) : sum); }
+        };
+
+        template<typename T>
+        struct accumulator<T, typename std::enable_if<!std::is_arithmetic<T>::value
+                                                      && easing::defaultEasing::supports_arithmetic_operations<T>::value>::type> {
+            T sum;
+            bool empty = true;
+
+            void add(const T & v, float w) {
+                if (empty) sum = v * w;
+                else sum = sum + v * w;
+                empty = false;
+            }
+            T result() const { return sum; }
+        };
+    }
+
+    /**
+     * @brief Blends the values of several tweens with the same value types, by weight.
+     *
+     * Each layer of a mixer is a tween with a weight, which can itself follow a tween. Stepping the mixer steps every
+     * layer and weight, then sets each value to the average of the values of all layers, weighted by their share of
+     * the total weight. Layers with a weight of zero keep running but are not evaluated. Values that have no
+     * arithmetic operators are taken from the heaviest layer.
+     *
+     * Mixers make interruptible transitions: to go to another animation, add it as a layer whose weight fades in,
+     * fade the weight of the running layers out, and remove them once they are silent.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::mixer<float, float> pose;
+     * size_t idle = pose.add(tweeny::from(0.0f, 0.0f).to(0.0f, 5.0f).during(800).repeat(-1).yoyo());
+     * size_t walk = pose.add(tweeny::from(0.0f, 0.0f).to(100.0f, 0.0f).during(1000), tweeny::from(0.0f).to(1.0f).during(250));
+     * pose.weight(idle, tweeny::from(1.0f).to(0.0f).during(250));
+     * auto values = pose.step(16); // blends idle into walk over a quarter of a second
+     * @endcode
+     */
+    template<typename T, typename... Ts>
+    class mixer {
+        public:
+            /**
+             * @brief The type of the values of each layer, as returned by tween::peek
+             */
+            typedef typename std::decay<decltype(std::declval<tween<T, Ts...>>().peek())>::type valuesType;
+
+            /**
+             * @brief Adds a layer with a fixed weight.
+             *
+             * @param t The tween of the layer, which is copied into the mixer
+             * @param weight A non-negative weight
+             * @returns The index of the layer
+             */
+            size_t add(const tween<T, Ts...> & t, float weight = 1.0f);
+
+            /**
+             * @brief Adds a layer whose weight follows a tween.
+             *
+             * @param t The tween of the layer, which is copied into the mixer
+             * @param weight A tween of non-negative weights, stepped along with the layer
+             * @returns The index of the layer
+             */
+            size_t add(const tween<T, Ts...> & t, const tween<float> & weight);
+
+            /**
+             * @brief Removes a layer. The layers after it move down by one index.
+             *
+             * @param layer A value returned by mixer::add
+             * @returns *this
+             */
+            mixer<T, Ts...> & remove(size_t layer);
+
+            /**
+             * @brief Returns the tween of a layer.
+             *
+             * @param layer A value returned by mixer::add
+             * @returns The tween
+             */
+            tween<T, Ts...> & operator[](size_t layer);
+            const tween<T, Ts...> & operator[](size_t layer) const; ///< @sa mixer::operator[]
+
+            /**
+             * @brief Returns the number of layers.
+             */
+            size_t size() const;
+
+            /**
+             * @brief Sets the weight of a layer, stopping any tween it followed.
+             *
+             * @param layer A value returned by mixer::add
+             * @param weight A non-negative weight
+             * @returns *this
+             */
+            mixer<T, Ts...> & weight(size_t layer, float weight);
+
+            /**
+             * @brief Makes the weight of a layer follow a tween, stepped along with the layer.
+             *
+             * @param layer A value returned by mixer::add
+             * @param weight A tween of non-negative weights
+             * @returns *this
+             */
+            mixer<T, Ts...> & weight(size_t layer, const tween<float> & weight);
+
+            /**
+             * @brief Returns the current weight of a layer.
+             *
+             * @param layer A value returned by mixer::add
+             */
+            float weight(size_t layer) const;
+
+            /**
+             * @brief Steps every layer and weight, then mixes the values of the layers.
+             *
+             * If every weight is zero, the values are left as they were.
+             *
+             * @param dt Delta duration, as taken by tween::step
+             * @param suppressCallbacks (Optional) Suppress callbacks of the layer and weight tweens
+             * @returns The mixed values
+             */
+            template<typename D> const valuesType & step(D dt, bool suppressCallbacks = false);
+
+            /**
+             * @brief Returns the values mixed by the last call to mixer::step.
+             */
+            const valuesType & peek() const;
+
+        private /* member types */:
+            typedef std::integral_constant<bool, sizeof...(Ts) == 0> single;
+
+        private /* member variables */:
+            std::vector<tween<T, Ts...>> tweens;
+            std::vector<float> weights;
+            std::vector<detail::cold<tween<float>>> curves; // tweens followed by the weights, if any
+            std::vector<detail::portion> portions; // layers with a weight, reused by every mix
+            valuesType mixed = valuesType();
+
+        private /* member functions */:
+            void mix();
+            template<size_t I> void mix(detail::int2type<I>);
+            void mix(detail::int2type<0>);
+    };
+}
+
+#include "mixer.tcc"
+
+#endif //TWEENY_MIXER_H
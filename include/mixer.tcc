@@ -0,0 +1,142 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the mixer.h file.
+ */
+
+#ifndef TWEENY_MIXER_TCC
+#define TWEENY_MIXER_TCC
+
+#include <cmath>
+
+#include "mixer.h"
+
+namespace tweeny {
+    template<typename T, typename... Ts>
+    size_t mixer<T, Ts...>::add(const tween<T, Ts...> & t, float weight) {
+        tweens.push_back(t);
+        weights.push_back(weight);
+        curves.emplace_back();
+        return tweens.size() - 1;
+    }
+
+    template<typename T, typename... Ts>
+    size_t mixer<T, Ts...>::add(const tween<T, Ts...> & t, const tween<float> & weight) {
+        size_t layer = add(t);
+        this->weight(layer, weight);
+        return layer;
+    }
+
+    template<typename T, typename... Ts>
+    mixer<T, Ts...> & mixer<T, Ts...>::remove(size_t layer) {
+        tweens.erase(tweens.begin() + static_cast<std::ptrdiff_t>(layer));
+        weights.erase(weights.begin() + static_cast<std::ptrdiff_t>(layer));
+        curves.erase(curves.begin() + static_cast<std::ptrdiff_t>(layer));
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & mixer<T, Ts...>::operator[](size_t layer) {
+        return tweens[layer];
+    }
+
+    template<typename T, typename... Ts>
+    const tween<T, Ts...> & mixer<T, Ts...>::operator[](size_t layer) const {
+        return tweens[layer];
+    }
+
+    template<typename T, typename... Ts>
+    size_t mixer<T, Ts...>::size() const {
+        return tweens.size();
+    }
+
+    template<typename T, typename... Ts>
+    mixer<T, Ts...> & mixer<T, Ts...>::weight(size_t layer, float weight) {
+        weights[layer] = weight;
+        curves[layer].object.reset();
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    mixer<T, Ts...> & mixer<T, Ts...>::weight(size_t layer, const tween<float> & weight) {
+        curves[layer].object.reset(new tween<float>(weight));
+        weights[layer] = curves[layer].object->seek(curves[layer].object->currentTimePoint(), true);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    float mixer<T, Ts...>::weight(size_t layer) const {
+        return weights[layer];
+    }
+
+    template<typename T, typename... Ts>
+    template<typename D>
+    const typename mixer<T, Ts...>::valuesType & mixer<T, Ts...>::step(D dt, bool suppress) {
+        for (size_t i = 0; i < tweens.size(); ++i) {
+            tweens[i].step(dt, suppress);
+            if (curves[i].object) weights[i] = curves[i].object->step(dt, suppress);
+        }
+        mix();
+        return mixed;
+    }
+
+    template<typename T, typename... Ts>
+    const typename mixer<T, Ts...>::valuesType & mixer<T, Ts...>::peek() const {
+        return mixed;
+    }
+
+    template<typename T, typename... Ts>
+    void mixer<T, Ts...>::mix() {
+        portions.clear();
+        float total = 0;
+        for (size_t i = 0; i < weights.size(); ++i) {
+            if (weights[i] <= 0) continue;
+            portions.push_back(detail::portion{ i, weights[i] });
+            total += weights[i];
+        }
+        if (portions.empty()) return;
+        for (detail::portion & p : portions) p.weight /= total;
+        mix(detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+    }
+
+    template<typename T, typename... Ts>
+    template<size_t I>
+    void mixer<T, Ts...>::mix(detail::int2type<I>) {
+        typedef typename std::tuple_element<I, std::tuple<T, Ts...>>::type valueType;
+        detail::accumulator<valueType> sum;
+        for (const detail::portion & p : portions) sum.add(detail::valueAt<I>(tweens[p.layer].peek(), single()), p.weight);
+        detail::valueAt<I>(mixed, single()) = sum.result();
+        mix(detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    void mixer<T, Ts...>::mix(detail::int2type<0>) {
+        detail::accumulator<T> sum;
+        for (const detail::portion & p : portions) sum.add(detail::valueAt<0>(tweens[p.layer].peek(), single()), p.weight);
+        detail::valueAt<0>(mixed, single()) = sum.result();
+    }
+}
+
+#endif //TWEENY_MIXER_TCC
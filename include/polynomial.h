@@ -0,0 +1,195 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file polynomial.h
+ * This file describes the bundled easings that are polynomials of the position, and the forward differences that
+ * step them by a fixed amount with a few additions.
+ */
+
+#ifndef TWEENY_POLYNOMIAL_H
+#define TWEENY_POLYNOMIAL_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "easing.h"
+
+namespace tweeny {
+    namespace detail {
+        /*
+         * An easing that is a polynomial of the position x, in one or two pieces each shaped as c + s * (k * x - o)^degree.
+         * The low piece runs before the split, the high piece from it on.
+         */
+        struct polynomial {
+            enum kind { in, out, inOut };
+
+            struct piece {
+                double c, s, k, o;
+            };
+
+            int degree;
+            double split;
+            piece low, high;
+        };
+
+        /* The shape of the In, Out and InOut easings of a degree, as written in easing.h */
+        template<int Degree, polynomial::kind Kind>
+        struct polynomials {
+            static const polynomial value;
+        };
+
+        template<int Degree, polynomial::kind Kind>
+        const polynomial polynomials<Degree, Kind>::value = {
+            Degree,
+            Kind == polynomial::inOut ? 0.5 : 2.0,
+            Kind == polynomial::in ? polynomial::piece{ 0, 1, 1, 0 }
+                : Kind == polynomial::out ? polynomial::piece{ 1, Degree % 2 ? 1.0 : -1.0, 1, 1 }
+                : polynomial::piece{ 0, 0.5, 2, 0 },
+            polynomial::piece{ 1, Degree % 2 ? 0.5 : -0.5, 2, 2 }
+        };
+
+        /* The shape of a bundled easing, or nullptr if it is not a polynomial */
+        template<typename EasingT>
+        struct polynomialof {
+            static constexpr const polynomial * value = nullptr;
+        };
+
+        template<typename EasingT>
+        constexpr const polynomial * polynomialof<EasingT>::value;
+
+        template<int Degree, polynomial::kind Kind>
+        struct shaped {
+            static constexpr const polynomial * value = &polynomials<Degree, Kind>::value;
+        };
+
+        template<int Degree, polynomial::kind Kind>
+        constexpr const polynomial * shaped<Degree, Kind>::value;
+
+        template<> struct polynomialof<easing::linearEasing> : shaped<1, polynomial::in> { };
+        template<> struct polynomialof<easing::quadraticInEasing> : shaped<2, polynomial::in> { };
+        template<> struct polynomialof<easing::quadraticOutEasing> : shaped<2, polynomial::out> { };
+        template<> struct polynomialof<easing::quadraticInOutEasing> : shaped<2, polynomial::inOut> { };
+        template<> struct polynomialof<easing::cubicInEasing> : shaped<3, polynomial::in> { };
+        template<> struct polynomialof<easing::cubicOutEasing> : shaped<3, polynomial::out> { };
+        template<> struct polynomialof<easing::cubicInOutEasing> : shaped<3, polynomial::inOut> { };
+        template<> struct polynomialof<easing::quarticInEasing> : shaped<4, polynomial::in> { };
+        template<> struct polynomialof<easing::quarticOutEasing> : shaped<4, polynomial::out> { };
+        template<> struct polynomialof<easing::quarticInOutEasing> : shaped<4, polynomial::inOut> { };
+        template<> struct polynomialof<easing::quinticInEasing> : shaped<5, polynomial::in> { };
+        template<> struct polynomialof<easing::quinticOutEasing> : shaped<5, polynomial::out> { };
+        template<> struct polynomialof<easing::quinticInOutEasing> : shaped<5, polynomial::inOut> { };
+
+        /*
+         * Forward differences of the eased position of one value, for a fixed stride. Stepping adds each difference to
+         * the one of lower order, which is exact for polynomials up to rounding.
+         */
+        struct differences {
+            double terms[6]; // the eased position, then its differences of increasing order
+            int degree = 0;
+            uint32_t left = 0; // steps before the table leaves its piece
+
+            /* Starts a table at some time of a segment, for a stride in either direction */
+            void start(const polynomial & shape, uint32_t elapsed, int64_t stride, uint16_t duration) {
+                /* Number of onto maps from i to m elements, the m-th difference of x^i at 0 with a step of 1 */
+                static const double onto[6][6] = {
+                    { 1 }, { 0, 1 }, { 0, 1, 2 }, { 0, 1, 6, 6 }, { 0, 1, 14, 36, 24 }, { 0, 1, 30, 150, 240, 120 }
+                };
+                static const double binomials[6][6] = {
+                    { 1 }, { 1, 1 }, { 1, 2, 1 }, { 1, 3, 3, 1 }, { 1, 4, 6, 4, 1 }, { 1, 5, 10, 10, 5, 1 }
+                };
+                double e = elapsed, d = duration, s = static_cast<double>(stride);
+                if (e >= d) { // the value has reached its end before the others
+                    degree = 0;
+                    terms[0] = 1;
+                    left = stride > 0 ? std::numeric_limits<uint32_t>::max() : static_cast<uint32_t>((e - d) / -s);
+                    return;
+                }
+
+                double x = e / d;
+                bool low = x < shape.split;
+                const polynomial::piece & p = low ? shape.low : shape.high;
+                double bound = stride > 0 ? (low ? std::fmin(shape.split, 1.0) : 1.0) : (low ? 0.0 : shape.split);
+                left = static_cast<uint32_t>((bound * d - e) / s);
+
+                int n = degree = shape.degree;
+                double u = p.k * x - p.o, h = p.k * s / d;
+                double powers[6] = { 1 }; // powers of u, then of h
+                for (int i = 1; i <= n; ++i) powers[i] = powers[i - 1] * u;
+                terms[0] = p.c + p.s * powers[n];
+                for (int m = 1; m <= n; ++m) {
+                    double sum = 0, step = 1;
+                    for (int i = 1; i <= n; ++i) {
+                        step *= h;
+                        if (i >= m) sum += binomials[n][i] * powers[n - i] * step * onto[i][m];
+                    }
+                    terms[m] = p.s * sum;
+                }
+            }
+
+            /* Moves to the next step and returns its eased position */
+            double next() {
+                for (int m = 0; m < degree; ++m) terms[m] += terms[m + 1];
+                --left;
+                return terms[0];
+            }
+        };
+
+        /* The difference tables of each value of a tween, and the render they were last used for */
+        template<size_t N>
+        struct stepping {
+            std::array<differences, N> tables;
+            uint32_t progress = 0;
+            int64_t stride = 0;
+            uint16_t point = 0;
+
+            /* Records a render, returning whether it continues the previous one with the same stride and point */
+            bool follows(uint32_t p, uint16_t at) {
+                int64_t s = int64_t(p) - int64_t(progress);
+                bool steady = s != 0 && s == stride && at == point;
+                progress = p;
+                stride = s;
+                point = at;
+                return steady;
+            }
+
+            /* Makes the next render start over, when points change */
+            void clear() { stride = 0; }
+        };
+
+        /* Writes the value eased to some position, for the value types that can be stepped with differences */
+        template<typename T>
+        typename std::enable_if<std::is_floating_point<T>::value>::type place(T & out, const T & start, const T & end, double eased) {
+            out = static_cast<T>(start + (end - start) * eased);
+        }
+
+        template<typename T>
+        typename std::enable_if<!std::is_floating_point<T>::value>::type place(T &, const T &, const T &, double) { }
+    }
+}
+
+#endif //TWEENY_POLYNOMIAL_H
@@ -0,0 +1,153 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file pool.h
+ * This file declares tweeny::pool, a container of tweens referred to by handles that detect removed tweens.
+ */
+
+#ifndef TWEENY_POOL_H
+#define TWEENY_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "tween.h"
+
+namespace tweeny {
+    /**
+     * @brief Refers to a tween in a tweeny::pool.
+     *
+     * Handles stay valid when other tweens are added or removed, and are recognized as stale once their own tween
+     * has been removed, even if its slot was reused since. A default constructed handle refers to nothing.
+     */
+    struct handle {
+        uint32_t index = std::numeric_limits<uint32_t>::max(); ///< Slot of the tween in its pool
+        uint32_t generation = 0; ///< Number of times that slot was emptied before the tween was added
+
+        bool operator==(const handle & other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const handle & other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief A container of tweens with the same value types, with handles that survive additions and removals.
+     *
+     * Adding, removing and finding a tween takes constant time. Tweens are stored contiguously whatever was added and
+     * removed before, so stepping a pool is as fast as stepping a std::vector of tweens. Removing a tween moves the
+     * last tween into its place: pointers to tweens and their order are not stable, handles are.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::pool<float, float> motions;
+     * tweeny::handle h = motions.add(tweeny::from(0.0f, 0.0f).to(100.0f, 50.0f).during(500));
+     * motions.step(16);
+     * motions.remove(h);
+     * if (!motions.find(h)) puts("removed");
+     * @endcode
+     */
+    template<typename T, typename... Ts>
+    class pool {
+        public:
+            /**
+             * @brief Adds a tween to this pool.
+             *
+             * @param t The tween to add, which is copied into the pool
+             * @returns A handle to it
+             */
+            handle add(const tween<T, Ts...> & t);
+            handle add(tween<T, Ts...> && t); ///< @sa pool::add, moves the tween into the pool instead
+
+            /**
+             * @brief Removes a tween from this pool, making its handle stale.
+             *
+             * @param h A handle returned by pool::add
+             * @returns false if the handle was already stale
+             */
+            bool remove(handle h);
+
+            /**
+             * @brief Removes every finished tween.
+             *
+             * @returns The number of tweens removed
+             */
+            size_t prune();
+
+            /**
+             * @brief Returns the tween of a handle, or nullptr if the handle is stale.
+             *
+             * The pointer is only valid until a tween is added to or removed from the pool.
+             *
+             * @param h A handle returned by pool::add
+             */
+            tween<T, Ts...> * find(handle h);
+            const tween<T, Ts...> * find(handle h) const; ///< @sa pool::find
+
+            /**
+             * @brief Returns true if a handle refers to a tween of this pool.
+             */
+            bool contains(handle h) const;
+
+            /**
+             * @brief Returns the number of tweens in this pool.
+             */
+            size_t size() const;
+
+            typename std::vector<tween<T, Ts...>>::iterator begin(); ///< Iterator to the first tween
+            typename std::vector<tween<T, Ts...>>::iterator end(); ///< Iterator past the last tween
+            typename std::vector<tween<T, Ts...>>::const_iterator begin() const; ///< Iterator to the first tween
+            typename std::vector<tween<T, Ts...>>::const_iterator end() const; ///< Iterator past the last tween
+
+            /**
+             * @brief Steps every tween of this pool.
+             *
+             * @param dt Delta duration, as taken by tween::step
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with tween::onStep()
+             */
+            template<typename D> void step(D dt, bool suppressCallbacks = false);
+
+        private /* member types */:
+            /* Where the tween of a handle is. Empty slots link to the next empty one instead */
+            struct slot {
+                uint32_t position;
+                uint32_t generation;
+            };
+
+        private /* member variables */:
+            std::vector<tween<T, Ts...>> tweens;
+            std::vector<uint32_t> owners; // slot of each tween
+            std::vector<slot> slots;
+            uint32_t vacant = std::numeric_limits<uint32_t>::max(); // first empty slot, if any
+
+        private /* member functions */:
+            void erase(uint32_t position);
+    };
+}
+
+#include "pool.tcc"
+
+#endif //TWEENY_POOL_H
@@ -0,0 +1,142 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the pool.h file.
+ */
+
+#ifndef TWEENY_POOL_TCC
+#define TWEENY_POOL_TCC
+
+#include "pool.h"
+
+namespace tweeny {
+    template<typename T, typename... Ts>
+    handle pool<T, Ts...>::add(const tween<T, Ts...> & t) {
+        return add(tween<T, Ts...>(t));
+    }
+
+    template<typename T, typename... Ts>
+    handle pool<T, Ts...>::add(tween<T, Ts...> && t) {
+        uint32_t index;
+        if (vacant != std::numeric_limits<uint32_t>::max()) {
+            index = vacant;
+            vacant = slots[index].position;
+        } else {
+            index = static_cast<uint32_t>(slots.size());
+            slots.push_back(slot{ 0, 0 });
+        }
+        slots[index].position = static_cast<uint32_t>(tweens.size());
+        tweens.push_back(std::move(t));
+        owners.push_back(index);
+        handle h;
+        h.index = index;
+        h.generation = slots[index].generation;
+        return h;
+    }
+
+    template<typename T, typename... Ts>
+    bool pool<T, Ts...>::remove(handle h) {
+        if (!contains(h)) return false;
+        erase(slots[h.index].position);
+        return true;
+    }
+
+    template<typename T, typename... Ts>
+    size_t pool<T, Ts...>::prune() {
+        size_t removed = 0;
+        for (size_t i = tweens.size(); i-- > 0;) {
+            if (!tweens[i].isFinished()) continue;
+            erase(static_cast<uint32_t>(i));
+            ++removed;
+        }
+        return removed;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> * pool<T, Ts...>::find(handle h) {
+        return contains(h) ? &tweens[slots[h.index].position] : nullptr;
+    }
+
+    template<typename T, typename... Ts>
+    const tween<T, Ts...> * pool<T, Ts...>::find(handle h) const {
+        return contains(h) ? &tweens[slots[h.index].position] : nullptr;
+    }
+
+    template<typename T, typename... Ts>
+    bool pool<T, Ts...>::contains(handle h) const {
+        if (h.index >= slots.size()) return false;
+        const slot & s = slots[h.index];
+        return s.generation == h.generation && s.position < owners.size() && owners[s.position] == h.index;
+    }
+
+    template<typename T, typename... Ts>
+    size_t pool<T, Ts...>::size() const {
+        return tweens.size();
+    }
+
+    template<typename T, typename... Ts>
+    typename std::vector<tween<T, Ts...>>::iterator pool<T, Ts...>::begin() {
+        return tweens.begin();
+    }
+
+    template<typename T, typename... Ts>
+    typename std::vector<tween<T, Ts...>>::iterator pool<T, Ts...>::end() {
+        return tweens.end();
+    }
+
+    template<typename T, typename... Ts>
+    typename std::vector<tween<T, Ts...>>::const_iterator pool<T, Ts...>::begin() const {
+        return tweens.begin();
+    }
+
+    template<typename T, typename... Ts>
+    typename std::vector<tween<T, Ts...>>::const_iterator pool<T, Ts...>::end() const {
+        return tweens.end();
+    }
+
+    template<typename T, typename... Ts>
+    template<typename D>
+    void pool<T, Ts...>::step(D dt, bool suppress) {
+        for (tween<T, Ts...> & t : tweens) t.step(dt, suppress);
+    }
+
+    template<typename T, typename... Ts>
+    void pool<T, Ts...>::erase(uint32_t position) {
+        uint32_t index = owners[position];
+        uint32_t last = static_cast<uint32_t>(tweens.size() - 1);
+        if (position != last) {
+            tweens[position] = std::move(tweens[last]);
+            owners[position] = owners[last];
+            slots[owners[position]].position = position;
+        }
+        tweens.pop_back();
+        owners.pop_back();
+        slots[index].generation++;
+        slots[index].position = vacant;
+        vacant = index;
+    }
+}
+
+#endif //TWEENY_POOL_TCC
@@ -0,0 +1,116 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file reduce.h
+ * This file declares tweeny::reduce, which replaces the points of recorded tweens by fewer, eased ones.
+ */
+
+#ifndef TWEENY_REDUCE_H
+#define TWEENY_REDUCE_H
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "tween.h"
+#include "easingresolve.h"
+#include "int2type.h"
+
+namespace tweeny {
+    /**
+     * @brief What tweeny::reduce did to a tween.
+     */
+    struct reduction {
+        size_t original = 0; ///< Number of points of the original tween
+        size_t reduced = 0; ///< Number of points of the reduced tween
+        double ratio = 1; ///< How many times fewer points the reduced tween has
+        double error = 0; ///< Largest difference between both tweens, at the time of an original point
+    };
+
+    namespace detail {
+        /* Fits the points of a tween with fewer points and bundled easings */
+        template<typename T, typename... Ts>
+        struct reducer {
+            typedef tween<T, Ts...> tweenType;
+            typedef tweenpoint<T, Ts...> pointType;
+            typedef typename tweentraits<T, Ts...>::valuesType valuesType;
+
+            /* A bundled easing that segments can be fitted with */
+            struct candidate {
+                std::tuple<const curve<T> *, const curve<Ts> *...> curves;
+                void (*apply)(pointType & p);
+            };
+
+            template<typename EasingT> static candidate make();
+            static const std::vector<candidate> & candidates();
+
+            static tweenType reduce(const tweenType & source, double tolerance, reduction * report);
+
+            /* Returns the largest error of a candidate over the points between first and last, or a value above the
+             * tolerance as soon as one is found */
+            static double error(const tweenType & source, const std::vector<uint32_t> & times, size_t first, size_t last,
+                                const candidate & c, double tolerance);
+
+            template<size_t I> static double error(const pointType & a, const pointType & b, const pointType & k,
+                                                    float position, const candidate & c, int2type<I>);
+            static double error(const pointType & a, const pointType & b, const pointType & k, float position,
+                                const candidate & c, int2type<0>);
+
+            template<int... S> static void emplace(tweenType & t, const valuesType & values, seq<S...>);
+        };
+    }
+
+    /**
+     * @brief Returns a tween with as few points as possible, following another one within a tolerance.
+     *
+     * Use it on tweens recorded with one point per sample, like motion capture, which take a lot of memory and get
+     * slower to step as they grow. Consecutive points are merged into segments for as long as one of the bundled
+     * easings (linear, polynomial, sinusoidal, exponential or circular) passes within @p tolerance of every point
+     * they replace. The reduced tween has the same duration and goes through the same values at the start and end
+     * of each of its segments. Callbacks, repeats and other settings are not carried over.
+     *
+     * Reducing is meant to be done offline or when loading a track: it evaluates every easing over every point of
+     * the candidate segments. Values must be arithmetic types. Per-value durations count as the longest of them.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::reduction report;
+     * auto small = tweeny::reduce(recorded, 0.01, &report);
+     * printf("%zu points instead of %zu, off by at most %g\n", report.reduced, report.original, report.error);
+     * @endcode
+     *
+     * @param source The tween to reduce
+     * @param tolerance The largest difference allowed for any value, at the time of any point of @p source
+     * @param report (Optional) Filled with the number of points before and after, and the largest difference
+     * @returns The reduced tween
+     */
+    template<typename T, typename... Ts>
+    tween<T, Ts...> reduce(const tween<T, Ts...> & source, double tolerance, reduction * report = nullptr);
+}
+
+#include "reduce.tcc"
+
+#endif //TWEENY_REDUCE_H
@@ -0,0 +1,180 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the reduce.h file.
+ */
+
+#ifndef TWEENY_REDUCE_TCC
+#define TWEENY_REDUCE_TCC
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "reduce.h"
+#include "dispatcher.h"
+
+namespace tweeny {
+    namespace detail {
+        template<typename... Ts> struct arithmetic : std::true_type { };
+        template<typename T, typename... Ts> struct arithmetic<T, Ts...> {
+            static const bool value = std::is_arithmetic<T>::value && arithmetic<Ts...>::value;
+        };
+
+        template<typename T, typename... Ts>
+        template<typename EasingT>
+        typename reducer<T, Ts...>::candidate reducer<T, Ts...>::make() {
+            return candidate{
+                std::make_tuple(&curveof<EasingT, T>::value, &curveof<EasingT, Ts>::value...),
+                [](pointType & p) { p.via(EasingT()); }
+            };
+        }
+
+        template<typename T, typename... Ts>
+        const std::vector<typename reducer<T, Ts...>::candidate> & reducer<T, Ts...>::candidates() {
+            /* Simplest first, as the first easing that fits is kept */
+            static const std::vector<candidate> list = {
+                make<easing::linearEasing>(),
+                make<easing::quadraticInEasing>(), make<easing::quadraticOutEasing>(), make<easing::quadraticInOutEasing>(),
+                make<easing::sinusoidalInEasing>(), make<easing::sinusoidalOutEasing>(), make<easing::sinusoidalInOutEasing>(),
+                make<easing::cubicInEasing>(), make<easing::cubicOutEasing>(), make<easing::cubicInOutEasing>(),
+                make<easing::circularInEasing>(), make<easing::circularOutEasing>(), make<easing::circularInOutEasing>(),
+                make<easing::quarticInEasing>(), make<easing::quarticOutEasing>(), make<easing::quarticInOutEasing>(),
+                make<easing::quinticInEasing>(), make<easing::quinticOutEasing>(), make<easing::quinticInOutEasing>(),
+                make<easing::exponentialInEasing>(), make<easing::exponentialOutEasing>(), make<easing::exponentialInOutEasing>()
+            };
+            return list;
+        }
+
+        template<typename T, typename... Ts>
+        tween<T, Ts...> reducer<T, Ts...>::reduce(const tweenType & source, double tolerance, reduction * report) {
+            static_assert(arithmetic<T, Ts...>::value, "Only tweens of arithmetic values can be reduced");
+            const std::vector<pointType> & points = source.points;
+            const size_t count = points.size();
+            tweenType result;
+            if (report) {
+                *report = reduction();
+                report->original = report->reduced = count;
+            }
+            if (count == 0) return result;
+
+            std::vector<uint32_t> times(count, 0); // time at which each point is reached
+            for (size_t k = 1; k < count; ++k) times[k] = points[k - 1].stacked;
+
+            double worst = 0;
+            emplace(result, points[0].values, typename gens<sizeof...(Ts) + 1>::type());
+            for (size_t first = 0; first + 1 < count;) {
+                /* Extends the segment for as long as an easing fits every point it replaces */
+                size_t last = first + 1;
+                const candidate * chosen = nullptr;
+                double chosenError = 0;
+                for (size_t next = first + 2; next < count; ++next) {
+                    if (times[next] - times[first] > std::numeric_limits<uint16_t>::max()) break;
+                    const candidate * fit = nullptr;
+                    double e = 0;
+                    for (const candidate & c : candidates()) {
+                        e = error(source, times, first, next, c, tolerance);
+                        if (e <= tolerance) { fit = &c; break; }
+                    }
+                    if (!fit) break;
+                    last = next;
+                    chosen = fit;
+                    chosenError = e;
+                }
+
+                pointType & start = result.points.back();
+                if (chosen) {
+                    start.during(times[last] - times[first]);
+                    chosen->apply(start);
+                    worst = std::max(worst, chosenError);
+                } else { // nothing to merge, the segment is kept as it is
+                    start.durations = points[first].durations;
+                    start.curves = points[first].curves;
+                    start.customs = points[first].customs;
+                }
+                emplace(result, points[last].values, typename gens<sizeof...(Ts) + 1>::type());
+                first = last;
+            }
+
+            for (pointType & p : result.points) {
+                result.total += p.duration();
+                p.stacked = result.total;
+            }
+            if (result.points.size() > 1) result.render(0);
+
+            if (report) {
+                report->reduced = result.points.size();
+                report->ratio = static_cast<double>(count) / report->reduced;
+                report->error = worst;
+            }
+            return result;
+        }
+
+        template<typename T, typename... Ts>
+        double reducer<T, Ts...>::error(const tweenType & source, const std::vector<uint32_t> & times, size_t first,
+                                        size_t last, const candidate & c, double tolerance) {
+            const pointType & a = source.points[first];
+            const pointType & b = source.points[last];
+            const float length = static_cast<float>(times[last] - times[first]);
+            double worst = 0;
+            for (size_t k = first + 1; k < last; ++k) {
+                float position = static_cast<float>(times[k] - times[first]) / length;
+                worst = std::max(worst, error(a, b, source.points[k], position, c, int2type<sizeof...(Ts)>{ }));
+                if (worst > tolerance) break;
+            }
+            return worst;
+        }
+
+        template<typename T, typename... Ts>
+        template<size_t I>
+        double reducer<T, Ts...>::error(const pointType & a, const pointType & b, const pointType & k, float position,
+                                        const candidate & c, int2type<I>) {
+            double eased = std::get<I>(c.curves)->run(position, std::get<I>(a.values), std::get<I>(b.values));
+            double e = std::fabs(eased - static_cast<double>(std::get<I>(k.values)));
+            return std::max(e, error(a, b, k, position, c, int2type<I - 1>{ }));
+        }
+
+        template<typename T, typename... Ts>
+        double reducer<T, Ts...>::error(const pointType & a, const pointType & b, const pointType & k, float position,
+                                        const candidate & c, int2type<0>) {
+            double eased = std::get<0>(c.curves)->run(position, std::get<0>(a.values), std::get<0>(b.values));
+            return std::fabs(eased - static_cast<double>(std::get<0>(k.values)));
+        }
+
+        template<typename T, typename... Ts>
+        template<int... S>
+        void reducer<T, Ts...>::emplace(tweenType & t, const valuesType & values, seq<S...>) {
+            t.points.emplace_back(std::get<S>(values)...);
+        }
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> reduce(const tween<T, Ts...> & source, double tolerance, reduction * report) {
+        return detail::reducer<T, Ts...>::reduce(source, tolerance, report);
+    }
+}
+
+#endif //TWEENY_REDUCE_TCC
@@ -0,0 +1,293 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file spring.h
+ * This file declares the spring and springs classes, which animate values with damped springs instead of easings.
+ */
+
+#ifndef TWEENY_SPRING_H
+#define TWEENY_SPRING_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace tweeny {
+    namespace detail {
+        /* The parameters of damped springs, shared by spring and springs */
+        struct physics {
+            float stiffness = 170; // force per unit of displacement
+            float damping = 26; // force per unit of velocity. With the default stiffness and mass, nearly critical
+            float mass = 1;
+            float substep = 1; // milliseconds integrated at once
+            float threshold = 1e-3f; // displacement under which a slow enough spring is at rest
+            double carry = 0; // milliseconds not integrated yet
+
+            /* Returns how many substeps a delta, in milliseconds, integrates, keeping the remainder for later */
+            uint32_t substeps(double dt);
+
+            /* Returns true if a spring this far from its target, moving at this velocity per second, is at rest */
+            bool resting(double displacement, double velocity) const;
+        };
+
+        /* Integrates springs with semi-implicit Euler, stable as long as substeps are short next to their period */
+        template<typename T>
+        void integrate(T * positions, T * velocities, const T * targets, size_t count, const physics & p, uint32_t substeps);
+    }
+
+    /**
+     * @brief A value that moves towards a target as if pulled by a damped spring.
+     *
+     * Unlike a tween, a spring has no duration nor easing: it has a velocity, which it keeps when its target changes.
+     * Interrupting it with spring::to() never makes it jump or stop abruptly. Springs are stepped and peeked like
+     * tweens, and call the same kind of step callbacks.
+     *
+     * Springs are integrated in fixed substeps, one millisecond long by default, so their motion does not depend on
+     * the frame rate. Use tweeny::springs to animate thousands of springs at once.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::spring<float> x(0.0f);
+     * x.to(100.0f).ratio(0.5f); // bounces around 100
+     * x.step(16);
+     * x.to(50.0f); // turns back smoothly
+     * @endcode
+     *
+     * @tparam T A floating point type
+     */
+    template<typename T>
+    class spring {
+        static_assert(std::is_floating_point<T>::value, "Springs need floating point values");
+
+        public:
+            typedef std::function<bool(spring<T> &, T)> callbackType; ///< @sa spring::onStep
+            typedef std::function<bool(spring<T> &)> noValuesCallbackType; ///< @sa spring::onStep
+            typedef std::function<bool(T)> noSpringCallbackType; ///< @sa spring::onStep
+
+            /**
+             * @brief Constructs a spring at rest at a value.
+             *
+             * @param value The initial value, which is also the initial target
+             */
+            explicit spring(T value = T());
+
+            /**
+             * @brief Sets the value this spring moves towards, keeping its current velocity.
+             *
+             * @param target The new target
+             * @returns *this
+             */
+            spring<T> & to(T target);
+
+            /**
+             * @brief Sets the stiffness of this spring. Stiffer springs move faster. Defaults to 170.
+             *
+             * @param k Force applied per unit of distance to the target
+             * @returns *this
+             */
+            spring<T> & stiffness(float k);
+
+            /**
+             * @brief Sets the damping of this spring. Defaults to 26.
+             *
+             * @param c Force resisting motion, per unit of velocity (per second)
+             * @returns *this
+             * @sa ratio
+             */
+            spring<T> & damping(float c);
+
+            /**
+             * @brief Sets the mass of this spring. Heavier springs are slower and bounce more. Defaults to 1.
+             *
+             * @param m The mass
+             * @returns *this
+             */
+            spring<T> & mass(float m);
+
+            /**
+             * @brief Sets the damping relative to the current stiffness and mass.
+             *
+             * A ratio of 1 makes the spring critically damped: it reaches its target as fast as possible without going
+             * past it. Lower ratios make it bounce around its target, and higher ratios make it slower.
+             *
+             * @param zeta The damping ratio
+             * @returns *this
+             * @sa damping
+             */
+            spring<T> & ratio(float zeta);
+
+            /**
+             * @brief Sets how long each integration substep is. Defaults to 1 millisecond.
+             *
+             * Shorter substeps are more accurate and stable for very stiff springs, and cost more.
+             *
+             * @param milliseconds The duration of a substep
+             * @returns *this
+             */
+            spring<T> & substep(float milliseconds);
+
+            /**
+             * @brief Steps the spring by a delta.
+             *
+             * Deltas shorter than a substep are carried to the next step.
+             *
+             * @param dt Delta duration, in milliseconds
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with spring::onStep()
+             * @returns The current value
+             */
+            const T & step(int32_t dt, bool suppressCallbacks = false);
+            const T & step(uint32_t dt, bool suppressCallbacks = false); ///< @sa spring::step(int32_t dt, bool suppressCallbacks)
+
+            /**
+             * @brief Steps the spring by a std::chrono duration.
+             *
+             * @param dt Delta duration, of any precision
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with spring::onStep()
+             * @returns The current value
+             */
+            template<typename Rep, typename Period>
+            const T & step(std::chrono::duration<Rep, Period> dt, bool suppressCallbacks = false);
+
+            /**
+             * @brief Returns the current value of this spring.
+             */
+            const T & peek() const;
+
+            /**
+             * @brief Returns the value this spring moves towards.
+             */
+            T target() const;
+
+            /**
+             * @brief Returns the current velocity of this spring, per millisecond, like tween::velocity.
+             */
+            T velocity() const;
+
+            /**
+             * @brief Returns true if this spring is at rest at its target.
+             */
+            bool isFinished() const;
+
+            /**
+             * @brief Adds a callback that will be called when stepping occurs.
+             *
+             * As with tween::onStep, returning true from the callback removes it.
+             *
+             * @param callback A callback in the form `bool f(spring<T> & s, T value)`
+             * @returns *this
+             */
+            spring<T> & onStep(callbackType callback);
+            spring<T> & onStep(noValuesCallbackType callback); ///< @sa spring::onStep(callbackType callback)
+            spring<T> & onStep(noSpringCallbackType callback); ///< @sa spring::onStep(callbackType callback)
+
+        private:
+            T current;
+            T currentVelocity = T(); // per second
+            T goal;
+            detail::physics params;
+            std::vector<callbackType> onStepCallbacks;
+
+        private:
+            const T & elapse(double dt, bool suppress);
+            void dispatch();
+    };
+
+    /**
+     * @brief Many springs with the same stiffness, damping and mass, integrated together.
+     *
+     * Values, velocities and targets are each stored in a contiguous array, and integrated in a loop that compilers
+     * can vectorize. Use it to animate thousands of values, like particles. Springs are identified by the index
+     * returned by springs::add.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::springs<float> heights;
+     * for (int i = 0; i < 1000; ++i) heights.add(0.0f);
+     * heights.to(42, 10.0f).ratio(0.3f);
+     * heights.step(16);
+     * upload(heights.data(), heights.size());
+     * @endcode
+     *
+     * @tparam T A floating point type
+     * @sa spring
+     */
+    template<typename T>
+    class springs {
+        static_assert(std::is_floating_point<T>::value, "Springs need floating point values");
+
+        public:
+            /**
+             * @brief Adds a spring at rest.
+             *
+             * @param value Its initial value, which is also its initial target
+             * @returns The index of the spring
+             */
+            size_t add(T value);
+
+            /**
+             * @brief Sets the target of a spring, keeping its current velocity.
+             *
+             * @param index A value returned by springs::add
+             * @param target The new target
+             * @returns *this
+             */
+            springs<T> & to(size_t index, T target);
+
+            springs<T> & stiffness(float k); ///< @sa spring::stiffness
+            springs<T> & damping(float c); ///< @sa spring::damping
+            springs<T> & mass(float m); ///< @sa spring::mass
+            springs<T> & ratio(float zeta); ///< @sa spring::ratio
+            springs<T> & substep(float milliseconds); ///< @sa spring::substep
+
+            void step(int32_t dt); ///< Steps every spring by a delta, in milliseconds
+            void step(uint32_t dt); ///< Steps every spring by a delta, in milliseconds
+
+            /**
+             * @brief Steps every spring by a std::chrono duration.
+             */
+            template<typename Rep, typename Period>
+            void step(std::chrono::duration<Rep, Period> dt);
+
+            const T & operator[](size_t index) const; ///< Returns the current value of a spring
+            T velocity(size_t index) const; ///< Returns the velocity of a spring, per millisecond
+            bool isFinished(size_t index) const; ///< Returns true if a spring is at rest at its target
+            size_t size() const; ///< Returns the number of springs
+            const T * data() const; ///< Returns the values of all springs, contiguously
+
+        private:
+            std::vector<T> positions;
+            std::vector<T> velocities; // per second
+            std::vector<T> targets;
+            detail::physics params;
+    };
+}
+
+#include "spring.tcc"
+
+#endif //TWEENY_SPRING_H
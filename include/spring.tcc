@@ -0,0 +1,240 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the spring.h file.
+ */
+
+#ifndef TWEENY_SPRING_TCC
+#define TWEENY_SPRING_TCC
+
+#include <algorithm>
+#include <cmath>
+
+#include "spring.h"
+
+namespace tweeny {
+    namespace detail {
+        inline uint32_t physics::substeps(double dt) {
+            double total = carry + dt;
+            if (total <= 0) { carry = 0; return 0; }
+            double whole = std::floor(total / substep);
+            carry = total - whole * substep;
+            return static_cast<uint32_t>(whole);
+        }
+
+        inline bool physics::resting(double displacement, double velocity) const {
+            /* Velocity is compared to the threshold travelled in a radian of oscillation, which also covers springs
+             * stalled by rounding, whose velocity does not move the value anymore */
+            return std::abs(displacement) <= threshold
+                && std::abs(velocity) <= threshold * std::sqrt(stiffness / mass);
+        }
+
+        template<typename T>
+        void integrate(T * x, T * v, const T * target, size_t count, const physics & p, uint32_t substeps) {
+            const T h = static_cast<T>(p.substep) / 1000;
+            const T k = static_cast<T>(p.stiffness) / p.mass * h;
+            const T c = static_cast<T>(p.damping) / p.mass * h;
+
+            /* Substeps run over blocks small enough to stay in cache, and the innermost loop has no dependency
+             * between springs, so it vectorizes */
+            const size_t block = 256;
+            for (size_t begin = 0; begin < count; begin += block) {
+                const size_t end = std::min(begin + block, count);
+                for (uint32_t s = 0; s < substeps; ++s) {
+                    for (size_t i = begin; i < end; ++i) {
+                        v[i] += (target[i] - x[i]) * k - v[i] * c;
+                        x[i] += v[i] * h;
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename T> inline spring<T>::spring(T value) : current(value), goal(value) { }
+
+    template<typename T> inline spring<T> & spring<T>::to(T target) {
+        goal = target;
+        return *this;
+    }
+
+    template<typename T> inline spring<T> & spring<T>::stiffness(float k) {
+        params.stiffness = k;
+        return *this;
+    }
+
+    template<typename T> inline spring<T> & spring<T>::damping(float c) {
+        params.damping = c;
+        return *this;
+    }
+
+    template<typename T> inline spring<T> & spring<T>::mass(float m) {
+        params.mass = m;
+        return *this;
+    }
+
+    template<typename T> inline spring<T> & spring<T>::ratio(float zeta) {
+        params.damping = 2 * zeta * std::sqrt(params.stiffness * params.mass);
+        return *this;
+    }
+
+    template<typename T> inline spring<T> & spring<T>::substep(float milliseconds) {
+        params.substep = milliseconds;
+        return *this;
+    }
+
+    template<typename T>
+    inline const T & spring<T>::elapse(double dt, bool suppress) {
+        if (!isFinished()) {
+            detail::integrate(&current, &currentVelocity, &goal, 1, params, params.substeps(dt));
+            if (isFinished()) {
+                current = goal;
+                currentVelocity = T();
+            }
+        }
+        if (!suppress) dispatch();
+        return current;
+    }
+
+    template<typename T>
+    inline const T & spring<T>::step(int32_t dt, bool suppress) {
+        return elapse(dt, suppress);
+    }
+
+    template<typename T>
+    inline const T & spring<T>::step(uint32_t dt, bool suppress) {
+        return elapse(dt, suppress);
+    }
+
+    template<typename T>
+    template<typename Rep, typename Period>
+    inline const T & spring<T>::step(std::chrono::duration<Rep, Period> dt, bool suppress) {
+        typedef std::ratio_divide<Period, std::milli> ratio;
+        return elapse(static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den), suppress);
+    }
+
+    template<typename T> inline const T & spring<T>::peek() const { return current; }
+    template<typename T> inline T spring<T>::target() const { return goal; }
+    template<typename T> inline T spring<T>::velocity() const { return currentVelocity / 1000; }
+
+    template<typename T> inline bool spring<T>::isFinished() const {
+        return params.resting(goal - current, currentVelocity);
+    }
+
+    template<typename T>
+    inline spring<T> & spring<T>::onStep(callbackType callback) {
+        onStepCallbacks.push_back(callback);
+        return *this;
+    }
+
+    template<typename T>
+    inline spring<T> & spring<T>::onStep(noValuesCallbackType callback) {
+        onStepCallbacks.push_back([callback](spring<T> & s, T) { return callback(s); });
+        return *this;
+    }
+
+    template<typename T>
+    inline spring<T> & spring<T>::onStep(noSpringCallbackType callback) {
+        onStepCallbacks.push_back([callback](spring<T> &, T v) { return callback(v); });
+        return *this;
+    }
+
+    template<typename T>
+    void spring<T>::dispatch() {
+        std::vector<size_t> dismissed;
+        for (size_t i = 0; i < onStepCallbacks.size(); ++i) {
+            if (onStepCallbacks[i](*this, current)) dismissed.push_back(i);
+        }
+
+        for (size_t i = dismissed.size(); i-- > 0;) {
+            onStepCallbacks[dismissed[i]] = std::move(onStepCallbacks.back());
+            onStepCallbacks.pop_back();
+        }
+    }
+
+    template<typename T> inline size_t springs<T>::add(T value) {
+        positions.push_back(value);
+        velocities.push_back(T());
+        targets.push_back(value);
+        return positions.size() - 1;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::to(size_t index, T target) {
+        targets.at(index) = target;
+        return *this;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::stiffness(float k) {
+        params.stiffness = k;
+        return *this;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::damping(float c) {
+        params.damping = c;
+        return *this;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::mass(float m) {
+        params.mass = m;
+        return *this;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::ratio(float zeta) {
+        params.damping = 2 * zeta * std::sqrt(params.stiffness * params.mass);
+        return *this;
+    }
+
+    template<typename T> inline springs<T> & springs<T>::substep(float milliseconds) {
+        params.substep = milliseconds;
+        return *this;
+    }
+
+    template<typename T> inline void springs<T>::step(int32_t dt) {
+        detail::integrate(positions.data(), velocities.data(), targets.data(), size(), params, params.substeps(dt));
+    }
+
+    template<typename T> inline void springs<T>::step(uint32_t dt) {
+        detail::integrate(positions.data(), velocities.data(), targets.data(), size(), params, params.substeps(dt));
+    }
+
+    template<typename T>
+    template<typename Rep, typename Period>
+    inline void springs<T>::step(std::chrono::duration<Rep, Period> dt) {
+        typedef std::ratio_divide<Period, std::milli> ratio;
+        double ms = static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den);
+        detail::integrate(positions.data(), velocities.data(), targets.data(), size(), params, params.substeps(ms));
+    }
+
+    template<typename T> inline const T & springs<T>::operator[](size_t index) const { return positions[index]; }
+    template<typename T> inline T springs<T>::velocity(size_t index) const { return velocities[index] / 1000; }
+
+    template<typename T> inline bool springs<T>::isFinished(size_t index) const {
+        return params.resting(targets[index] - positions[index], velocities[index]);
+    }
+
+    template<typename T> inline size_t springs<T>::size() const { return positions.size(); }
+    template<typename T> inline const T * springs<T>::data() const { return positions.data(); }
+}
+
+#endif //TWEENY_SPRING_TCC
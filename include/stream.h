@@ -0,0 +1,195 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file stream.h
+ * This file declares the stream class, which interpolates between keyframes arriving while it plays.
+ */
+
+#ifndef TWEENY_STREAM_H
+#define TWEENY_STREAM_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "tweentraits.h"
+#include "tweenpoint.h"
+#include "int2type.h"
+
+namespace tweeny {
+    namespace detail {
+        /* The values a stream returns: a single value is returned as is, like tween<T> does */
+        template<typename T, typename... Ts>
+        struct streamvalues {
+            typedef typename tweentraits<T, Ts...>::valuesType type;
+            static const type & get(const type & values) { return values; }
+        };
+
+        template<typename T>
+        struct streamvalues<T> {
+            typedef T type;
+            static const T & get(const typename tweentraits<T>::valuesType & values) { return std::get<0>(values); }
+        };
+    }
+
+    /**
+     * @brief Interpolates values between timed keyframes that keep arriving, like network snapshots.
+     *
+     * A tween that gets a point for every keyframe grows forever. A stream instead keeps a fixed number of keyframes
+     * in a ring buffer: pushing one is O(1), and keyframes are dropped once they are played. Nothing is allocated
+     * after construction.
+     *
+     * Keyframes are stamped with the time they were taken at, in milliseconds of the sender clock. Playback starts
+     * at the first keyframe, minus a delay. Stepping the stream moves its playhead, and its values are interpolated
+     * between the two keyframes around it. The delay is a jitter buffer: it lets keyframes arrive late or unevenly
+     * while the playhead still has one ahead to move towards. If it runs out of keyframes, the stream holds the last
+     * one until more arrive. A stream of a single value returns it as is, instead of an array of one value.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::stream<float, float> position(8);
+     * position.delay(100); // two snapshots at 20Hz
+     *
+     * // when a snapshot arrives
+     * position.push(snapshot.time, snapshot.x, snapshot.y);
+     *
+     * // every frame
+     * auto xy = position.step(7);
+     * @endcode
+     */
+    template<typename T, typename... Ts>
+    class stream {
+        public:
+            /**
+             * @brief Constructs an empty stream.
+             *
+             * @param capacity How many keyframes it keeps. Pushing a keyframe to a full stream drops the oldest one.
+             */
+            explicit stream(size_t capacity = 16);
+
+            /**
+             * @brief Adds a keyframe.
+             *
+             * Keyframes must arrive in order: a keyframe not newer than the last one is ignored.
+             *
+             * @param time When the values were taken, in milliseconds
+             * @param t, vs The values
+             * @returns Whether the keyframe was added
+             */
+            bool push(uint32_t time, T t, Ts... vs);
+
+            /**
+             * @brief Sets how far behind keyframes the stream plays. Defaults to 100 milliseconds.
+             *
+             * Changing it while playing moves the playhead.
+             *
+             * @param milliseconds The delay
+             * @returns *this
+             */
+            stream<T, Ts...> & delay(uint32_t milliseconds);
+
+            /**
+             * @brief Returns how far behind keyframes the stream plays.
+             */
+            uint32_t delay() const;
+
+            /**
+             * @brief Sets the easing used between keyframes. Defaults to tweeny::easing::linear.
+             *
+             * @param fs An easing for every value, or a single one for all of them
+             * @returns *this
+             * @see tween::via
+             */
+            template<typename... Fs> stream<T, Ts...> & via(Fs... fs);
+
+            /**
+             * @brief Moves the playhead by a delta.
+             *
+             * @param dt Delta duration, in milliseconds
+             * @returns The current values
+             */
+            const typename detail::streamvalues<T, Ts...>::type & step(int32_t dt);
+            const typename detail::streamvalues<T, Ts...>::type & step(uint32_t dt); ///< @sa stream::step(int32_t dt)
+
+            /**
+             * @brief Moves the playhead by a std::chrono duration.
+             *
+             * @param dt Delta duration, of any precision
+             * @returns The current values
+             */
+            template<typename Rep, typename Period>
+            const typename detail::streamvalues<T, Ts...>::type & step(std::chrono::duration<Rep, Period> dt);
+
+            /**
+             * @brief Returns the current values.
+             */
+            const typename detail::streamvalues<T, Ts...>::type & peek() const;
+
+            /**
+             * @brief Returns the time of the playhead, in milliseconds of the sender clock.
+             */
+            int64_t time() const;
+
+            /**
+             * @brief Returns how many keyframes are buffered, including the one the playhead is past.
+             */
+            size_t size() const;
+
+            /**
+             * @brief Returns true if the playhead went past every keyframe, or if none arrived yet.
+             */
+            bool isStarved() const;
+
+        private /* member types */:
+            using traits = detail::tweentraits<T, Ts...>;
+
+            struct keyframe {
+                uint32_t time;
+                typename traits::valuesType values;
+            };
+
+        private /* member variables */:
+            std::vector<keyframe> keyframes; // ring buffer
+            size_t head = 0; // index of the oldest keyframe
+            size_t count = 0; // number of keyframes
+            int64_t now = 0; // playhead
+            uint32_t lag = 100; // delay
+            bool started = false; // whether a keyframe ever arrived
+            double carry = 0; // fraction of a millisecond not yet stepped
+            detail::tweenpoint<T, Ts...> shape; // holds the easings
+            typename traits::valuesType current;
+
+        private:
+            const keyframe & at(size_t index) const;
+            const typename detail::streamvalues<T, Ts...>::type & advance(int64_t dt);
+            template<size_t I> void interpolate(float progress, const keyframe & a, const keyframe & b, detail::int2type<I>);
+            void interpolate(float progress, const keyframe & a, const keyframe & b, detail::int2type<0>);
+    };
+}
+
+#include "stream.tcc"
+
+#endif //TWEENY_STREAM_H
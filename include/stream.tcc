@@ -0,0 +1,162 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the stream.h file.
+ */
+
+#ifndef TWEENY_STREAM_TCC
+#define TWEENY_STREAM_TCC
+
+#include <algorithm>
+#include <cmath>
+
+#include "stream.h"
+
+namespace tweeny {
+    template<typename T, typename... Ts>
+    inline stream<T, Ts...>::stream(size_t capacity)
+        : keyframes(std::max<size_t>(capacity, 2)), shape(T(), Ts()...) {
+        shape.via(easing::linear);
+    }
+
+    template<typename T, typename... Ts>
+    inline bool stream<T, Ts...>::push(uint32_t time, T t, Ts... vs) {
+        if (count > 0 && time <= at(count - 1).time) return false;
+        if (count == keyframes.size()) {
+            head = (head + 1) % keyframes.size();
+            count--;
+        }
+        keyframe & k = keyframes[(head + count) % keyframes.size()];
+        k.time = time;
+        k.values = typename traits::valuesType{ t, vs... };
+        count++;
+        if (!started) {
+            started = true;
+            now = int64_t(time) - lag;
+        }
+        advance(0);
+        return true;
+    }
+
+    template<typename T, typename... Ts>
+    inline stream<T, Ts...> & stream<T, Ts...>::delay(uint32_t milliseconds) {
+        now += int64_t(lag) - milliseconds;
+        lag = milliseconds;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    inline uint32_t stream<T, Ts...>::delay() const {
+        return lag;
+    }
+
+    template<typename T, typename... Ts>
+    template<typename... Fs>
+    inline stream<T, Ts...> & stream<T, Ts...>::via(Fs... fs) {
+        shape.via(fs...);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename detail::streamvalues<T, Ts...>::type & stream<T, Ts...>::step(int32_t dt) {
+        return advance(dt);
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename detail::streamvalues<T, Ts...>::type & stream<T, Ts...>::step(uint32_t dt) {
+        return advance(dt);
+    }
+
+    template<typename T, typename... Ts>
+    template<typename Rep, typename Period>
+    inline const typename detail::streamvalues<T, Ts...>::type & stream<T, Ts...>::step(std::chrono::duration<Rep, Period> dt) {
+        typedef std::ratio_divide<Period, std::milli> ratio;
+        double scaled = static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den) + carry;
+        double whole = std::floor(scaled);
+        carry = scaled - whole;
+        return advance(static_cast<int64_t>(whole));
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename stream<T, Ts...>::keyframe & stream<T, Ts...>::at(size_t index) const {
+        return keyframes[(head + index) % keyframes.size()];
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename detail::streamvalues<T, Ts...>::type & stream<T, Ts...>::advance(int64_t dt) {
+        if (!started) return detail::streamvalues<T, Ts...>::get(current);
+        now += dt;
+
+        /* Drops keyframes the playhead is past, keeping the one it is interpolating from */
+        while (count > 1 && now >= at(1).time) {
+            head = (head + 1) % keyframes.size();
+            count--;
+        }
+
+        const keyframe & a = at(0);
+        if (count == 1 || now <= a.time) {
+            current = a.values;
+        } else {
+            const keyframe & b = at(1);
+            float progress = static_cast<float>(now - a.time) / static_cast<float>(b.time - a.time);
+            interpolate(progress, a, b, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        }
+        return detail::streamvalues<T, Ts...>::get(current);
+    }
+
+    template<typename T, typename... Ts>
+    template<size_t I>
+    inline void stream<T, Ts...>::interpolate(float progress, const keyframe & a, const keyframe & b, detail::int2type<I>) {
+        std::get<I>(current) = shape.template ease<I>(progress, std::get<I>(a.values), std::get<I>(b.values));
+        interpolate(progress, a, b, detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void stream<T, Ts...>::interpolate(float progress, const keyframe & a, const keyframe & b, detail::int2type<0>) {
+        std::get<0>(current) = shape.template ease<0>(progress, std::get<0>(a.values), std::get<0>(b.values));
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename detail::streamvalues<T, Ts...>::type & stream<T, Ts...>::peek() const {
+        return detail::streamvalues<T, Ts...>::get(current);
+    }
+
+    template<typename T, typename... Ts>
+    inline int64_t stream<T, Ts...>::time() const {
+        return now;
+    }
+
+    template<typename T, typename... Ts>
+    inline size_t stream<T, Ts...>::size() const {
+        return count;
+    }
+
+    template<typename T, typename... Ts>
+    inline bool stream<T, Ts...>::isStarved() const {
+        return count == 0 || (count == 1 && now >= at(0).time);
+    }
+}
+
+#endif //TWEENY_STREAM_TCC
@@ -0,0 +1,173 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file timescale.h
+ * This file declares tweeny::timescale, which steps groups of tweens and collections at their own rate.
+ */
+
+#ifndef TWEENY_TIMESCALE_H
+#define TWEENY_TIMESCALE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tween.h"
+
+namespace tweeny {
+    /**
+     * @brief Steps a group of collections, tweens or other timescales at a rate of its own.
+     *
+     * A timescale is a layer of time: stepping it steps every member by the delta multiplied by its rate, so that
+     * slowing down or pausing a whole part of a scene is a single call. Timescales can be members of other timescales,
+     * whose rates then multiply. The rate can follow a tween, such as a ramp into slow motion and back.
+     *
+     * Members are referred to, not owned: they must outlive the timescale or be removed from it before. Each one is
+     * stepped with a std::chrono duration, so fractions of a millisecond are carried by the members. A paused
+     * timescale, or one at a rate of zero, does not touch its members at all.
+     *
+     * **Example**:
+     *
+     * @code
+     * tweeny::collection<float, float> enemies;
+     * tweeny::collection<float> interface;
+     * tweeny::timescale world, game;
+     * world.add(enemies);
+     * game.add(world).add(interface);
+     *
+     * world.rate(tweeny::from(1.0f).to(0.2f).during(300).to(0.2f).during(2000).to(1.0f).during(300)); // bullet time
+     * game.step(16); // enemies slow down while the interface keeps its pace
+     * @endcode
+     */
+    class timescale {
+        public:
+            /**
+             * @brief Sets the rate at which members are stepped.
+             *
+             * Clears any rate set with timescale::rate(tween<float>).
+             *
+             * @param rate A non-negative rate. `1.0f` is the normal speed, `0.0f` stops every member.
+             * @returns *this
+             */
+            timescale & rate(float rate);
+
+            /**
+             * @brief Makes the rate follow a tween, stepped by the deltas this timescale receives.
+             *
+             * The tween is stepped before the members, by the unscaled delta, and its value is used as the rate.
+             * Once it finishes, its last value is kept.
+             *
+             * @param curve A tween of non-negative rates
+             * @returns *this
+             */
+            timescale & rate(tween<float> curve);
+
+            /**
+             * @brief Returns the current rate of this timescale, not counting the timescales it is a member of.
+             */
+            float rate() const;
+
+            /**
+             * @brief Stops stepping the members and the rate tween, until timescale::resume is called.
+             * @returns *this
+             */
+            timescale & pause();
+
+            /**
+             * @brief Resumes stepping after timescale::pause.
+             * @returns *this
+             */
+            timescale & resume();
+
+            /**
+             * @brief Returns true if this timescale is paused.
+             */
+            bool isPaused() const;
+
+            /**
+             * @brief Adds a member to this timescale.
+             *
+             * Members are stepped in the order they were added, and are stepped twice if added twice.
+             *
+             * @param member A tween, collection, spring, stream or timescale, or anything else that can be stepped by
+             * a std::chrono duration
+             * @returns *this
+             */
+            template<typename S> timescale & add(S & member);
+
+            /**
+             * @brief Removes a member from this timescale.
+             *
+             * @param member A member added with timescale::add
+             * @returns *this
+             */
+            template<typename S> timescale & remove(S & member);
+
+            /**
+             * @brief Returns the number of members of this timescale.
+             */
+            size_t size() const;
+
+            /**
+             * @brief Steps every member by a delta multiplied by the rate.
+             *
+             * @param dt Delta duration, in milliseconds
+             */
+            void step(int32_t dt);
+            void step(uint32_t dt); ///< @sa timescale::step(int32_t dt)
+
+            /**
+             * @brief Steps every member by a std::chrono duration multiplied by the rate.
+             *
+             * @param dt Delta duration, of any precision
+             */
+            template<typename Rep, typename Period>
+            void step(std::chrono::duration<Rep, Period> dt);
+
+        private /* member types */:
+            typedef std::chrono::duration<double, std::milli> span;
+
+            /* A member of any type, stepped through a function instantiated for it */
+            struct member {
+                void * target;
+                void (*step)(void * target, span dt);
+            };
+
+        private /* member variables */:
+            std::vector<member> members;
+            float speed = 1.0f;
+            bool paused = false;
+            detail::cold<tween<float>> curve; // tween the rate follows, if any
+
+        private /* member functions */:
+            template<typename S> static void relay(void * target, span dt);
+            void advance(double dt);
+    };
+}
+
+#include "timescale.tcc"
+
+#endif //TWEENY_TIMESCALE_H
@@ -0,0 +1,113 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * The purpose of this file is to hold implementations for the timescale.h file.
+ */
+
+#ifndef TWEENY_TIMESCALE_TCC
+#define TWEENY_TIMESCALE_TCC
+
+#include <algorithm>
+
+#include "timescale.h"
+
+namespace tweeny {
+    inline timescale & timescale::rate(float rate) {
+        speed = rate;
+        curve.object.reset();
+        return *this;
+    }
+
+    inline timescale & timescale::rate(tween<float> t) {
+        speed = t.seek(0u, true);
+        curve.object.reset(new tween<float>(std::move(t)));
+        return *this;
+    }
+
+    inline float timescale::rate() const {
+        return speed;
+    }
+
+    inline timescale & timescale::pause() {
+        paused = true;
+        return *this;
+    }
+
+    inline timescale & timescale::resume() {
+        paused = false;
+        return *this;
+    }
+
+    inline bool timescale::isPaused() const {
+        return paused;
+    }
+
+    template<typename S>
+    timescale & timescale::add(S & m) {
+        members.push_back(member{ &m, &relay<S> });
+        return *this;
+    }
+
+    template<typename S>
+    timescale & timescale::remove(S & m) {
+        void * target = &m;
+        members.erase(std::remove_if(members.begin(), members.end(), [target](const member & x) {
+            return x.target == target;
+        }), members.end());
+        return *this;
+    }
+
+    inline size_t timescale::size() const {
+        return members.size();
+    }
+
+    inline void timescale::step(int32_t dt) {
+        advance(dt);
+    }
+
+    inline void timescale::step(uint32_t dt) {
+        advance(dt);
+    }
+
+    template<typename Rep, typename Period>
+    void timescale::step(std::chrono::duration<Rep, Period> dt) {
+        advance(std::chrono::duration_cast<span>(dt).count());
+    }
+
+    template<typename S>
+    void timescale::relay(void * target, span dt) {
+        static_cast<S *>(target)->step(dt);
+    }
+
+    inline void timescale::advance(double dt) {
+        if (paused) return;
+        if (curve.object) speed = curve.object->step(span(dt));
+        double scaled = dt * speed;
+        if (scaled == 0) return;
+        for (const member & m : members) m.step(m.target, span(scaled));
+    }
+}
+
+#endif //TWEENY_TIMESCALE_TCC
@@ -0,0 +1,106 @@
+/*
+ This file is part of the Tweeny library.
+
+ Copyright (c) 2016-2025 Leonardo Guilherme Lucena de Freitas
+ Copyright (c) 2016 Guilherme R. Costa
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of
+ this software and associated documentation files (the "Software"), to deal in
+ the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ the Software, and to permit persons to whom the Software is furnished to do so,
+ subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+ * This file declares a triple buffer, used to publish tween values to another thread without locks.
+ * This file is private.
+ */
+
+#ifndef TWEENY_TRIPLEBUFFER_H
+#define TWEENY_TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace tweeny {
+    namespace detail {
+        /*
+         * A single producer, single consumer triple buffer. The producer writes into its own slot and swaps it with
+         * the middle one; the consumer swaps its own slot with the middle one only if it was written since the
+         * last read. Neither side ever waits for the other, and the consumer always sees a complete value.
+         */
+        template<typename V>
+        class triplebuffer {
+            public:
+                triplebuffer() : slots(), middle(1), back(0), front(2) { }
+
+                triplebuffer(const triplebuffer & other)
+                    : slots(other.slots), middle(other.middle.load()), back(other.back), front(other.front) { }
+
+                triplebuffer & operator=(const triplebuffer & other) {
+                    slots = other.slots;
+                    middle.store(other.middle.load());
+                    back = other.back;
+                    front = other.front;
+                    return *this;
+                }
+
+                triplebuffer(triplebuffer && other) noexcept(std::is_nothrow_move_constructible<V>::value)
+                    : slots(std::move(other.slots)), middle(other.middle.load()), back(other.back), front(other.front) { }
+
+                triplebuffer & operator=(triplebuffer && other) noexcept(std::is_nothrow_move_assignable<V>::value) {
+                    slots = std::move(other.slots);
+                    middle.store(other.middle.load());
+                    back = other.back;
+                    front = other.front;
+                    return *this;
+                }
+
+                /* Called by the producer. Publishes a new value. */
+                void write(const V & value) {
+                    slots[back] = value;
+                    publish();
+                }
+
+                /* Called by the consumer. Returns the latest published value, valid until the next call. */
+                const V & read() {
+                    if (middle.load(std::memory_order_relaxed) & fresh)
+                        front = middle.exchange(front, std::memory_order_acq_rel) & index;
+                    return slots[front];
+                }
+
+                /* Called by the producer. Gives access to the slot that will be published next. */
+                V & next() {
+                    return slots[back];
+                }
+
+                /* Called by the producer. Publishes the slot returned by next(). */
+                void publish() {
+                    back = middle.exchange(static_cast<uint8_t>(back | fresh), std::memory_order_acq_rel) & index;
+                }
+
+            private:
+                enum : uint8_t { index = 3, fresh = 4 };
+                std::array<V, 3> slots;
+                std::atomic<uint8_t> middle; // index of the middle slot, and whether it holds an unread value
+                uint8_t back; // slot owned by the producer
+                uint8_t front; // slot owned by the consumer
+        };
+    }
+}
+
+#endif //TWEENY_TRIPLEBUFFER_H
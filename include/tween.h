@@ -32,13 +32,70 @@
 
 #include <tuple>
 #include <vector>
+#include <chrono>
 #include <functional>
 #include <string>
+#include <stdexcept>
+#include <utility>
 
 #include "tweentraits.h"
 #include "tweenpoint.h"
+#include "triplebuffer.h"
+#include "awaiter.h"
 
 namespace tweeny {
+    namespace detail {
+        /* Everything stepping and seeking a tween changes. Trivially copyable when its values are */
+        template<typename ValuesT>
+        struct playback {
+            ValuesT current;
+            double carry; // fraction of a duration unit not yet stepped
+            uint32_t progress; // time point
+            uint32_t cycle;
+            uint16_t point; // index of the running segment
+            int8_t direction;
+        };
+
+        /* Where the playback state of a tween is kept. A tween has its own, unless a collection keeps it in an array
+         * with the states of its other tweens, see detail::roster. Copies of a tween always get their own state,
+         * while assigning to a tween writes into wherever its state is */
+        template<typename StateT>
+        struct seat {
+            StateT own;
+            StateT * at = &own;
+
+            seat(const StateT & state) : own(state) { }
+            seat(const seat & other) : own(*other.at) { }
+            seat(seat && other) noexcept(std::is_nothrow_move_constructible<StateT>::value) : own(std::move(*other.at)) { }
+            seat & operator=(const seat & other) { *at = *other.at; return *this; }
+            seat & operator=(seat && other) noexcept(std::is_nothrow_move_assignable<StateT>::value) {
+                *at = std::move(*other.at);
+                return *this;
+            }
+
+            StateT * operator->() { return at; }
+            const StateT * operator->() const { return at; }
+            StateT & operator*() { return *at; }
+            const StateT & operator*() const { return *at; }
+        };
+
+        template<typename TweenT> struct roster;
+
+        /* A callback called when a tween passes over a time point */
+        template<typename CallbackT>
+        struct cue {
+            uint32_t time;
+            CallbackT callback;
+        };
+
+        /* The bump of a segment that starts at a matched velocity, see tween::retarget */
+        template<typename VelocitiesT>
+        struct kick {
+            VelocitiesT heights;
+            uint16_t point; // point whose segment is bumped
+        };
+    }
+
     /**
      * @brief The tween class is the core class of tweeny. It controls the interpolation steps, easings and durations.
      *
@@ -57,6 +114,8 @@ namespace tweeny {
              */
             static tween<T, Ts...> from(T t, Ts... vs);
 
+            typedef detail::playback<typename detail::tweentraits<T, Ts...>::valuesType> stateType; ///< @sa tween::snapshot
+
         public:
             /**
              * @brief Default constructor for a tween
@@ -197,6 +256,35 @@ namespace tweeny {
              */
             template<typename... Ds> tween<T, Ts...> & during(Ds... ds);
 
+            /**
+             * @brief Sends the tween somewhere else, starting from where it currently is.
+             *
+             * Calling tween::to on a running tween adds points to it forever. Instead, this moves the last point to
+             * new values, reached @p duration after the point before it, and makes the running segment start over from
+             * the current values, over the time that was left of it. The points in between are kept and still reached
+             * when they would have been, and no point is added or removed. The repeat count, the yoyo cycle and the
+             * direction are kept too, so a tween playing backwards keeps heading to its first point. Use it for
+             * destinations that change while animating, like a camera following a moving target.
+             *
+             * With @p matchVelocity, a tween heading to the new values starts the segment at the velocity it had,
+             * instead of the velocity of its easing, so that changing direction is smooth. It still ends like its easing
+             * does, and the next loop, tween::to, tween::during or tween::via drop the matched velocity.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto tween = tweeny::from(0.0f, 0.0f).to(100.0f, 100.0f).during(500);
+             * tween.step(200);
+             * tween.retarget(50.0f, 300.0f, 400, true); // now heads to (50, 300), reaching it in 400ms
+             * @endcode
+             *
+             * @param t, vs The new target values
+             * @param duration How long the last segment takes to reach them
+             * @param matchVelocity (Optional) Whether the segment starts at the current velocity
+             * @returns *this
+             */
+            tween<T, Ts...> & retarget(T t, Ts... vs, uint16_t duration, bool matchVelocity = false);
+
             /**
              * @brief Steps the animation by the designated delta amount.
              *
@@ -252,6 +340,27 @@ namespace tweeny {
              */
             const typename detail::tweentraits<T, Ts...>::valuesType & step(float dp, bool suppressCallbacks = false);
 
+            /**
+             * @brief Steps the animation by a `std::chrono` duration.
+             *
+             * The duration is converted to milliseconds, assuming that is the unit used in tween::during. Fractions of a
+             * millisecond are carried over to the next step instead of being truncated, so stepping by high refresh
+             * rate frame times (e.g, 4.16ms at 240Hz) does not make the animation run slow.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto tween = tweeny::from(0).to(100).during(1000);
+             * tween.step(std::chrono::microseconds(4167));
+             * @endcode
+             *
+             * @param dt Delta duration
+             * @param suppressCallbacks (Optional) Suppress callbacks registered with tween::onStep()
+             * @returns std::tuple<Ts...> with the current tween values.
+             */
+            template<typename Rep, typename Period>
+            const typename detail::tweentraits<T, Ts...>::valuesType & step(std::chrono::duration<Rep, Period> dt, bool suppressCallbacks = false);
+
             /**
              * @brief Seeks to a specified point in time based on the currentProgress.
              *
@@ -506,6 +615,65 @@ namespace tweeny {
              */
             const typename detail::tweentraits<T, Ts...>::valuesType peek(uint32_t time) const;
 
+            /**
+             * @brief Calculates and returns the tween values at a given progress, along with their velocities
+             *
+             * This is the same as calling tween::peek(float) and tween::peekVelocity(float), but looks up the
+             * tween point only once.
+             * @param progress The progress to evaluate, between 0.0f and 1.0f
+             * @param velocities Receives the velocity of each value
+             * @returns std::tuple<Ts...> with the calculated tween values.
+             */
+            const typename detail::tweentraits<T, Ts...>::valuesType peek(float progress, typename detail::tweentraits<T, Ts...>::velocitiesType & velocities) const;
+
+            /**
+             * @brief Calculates and returns the tween values at a given time, along with their velocities
+             *
+             * This is the same as calling tween::peek(uint32_t) and tween::peekVelocity(uint32_t), but looks up the
+             * tween point only once.
+             * @param time The time to evaluate, between 0 and the total duration
+             * @param velocities Receives the velocity of each value
+             * @returns std::tuple<Ts...> with the calculated tween values.
+             */
+            const typename detail::tweentraits<T, Ts...>::valuesType peek(uint32_t time, typename detail::tweentraits<T, Ts...>::velocitiesType & velocities) const;
+
+            /**
+             * @brief Returns the current velocity of the tween values
+             *
+             * The velocity is the derivative of each value in respect to time, in value units per duration unit. Bundled
+             * easings compute it analytically; custom easings are approximated numerically. A value that already reached
+             * its point (because it has a shorter duration) has zero velocity. The velocity of an integer value is a float.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto tween = tweeny::from(0.0f).to(100.0f).during(100).via(tweeny::easing::linear);
+             * tween.step(50);
+             * float v = tween.velocity(); // 1.0f, i.e, 100 units in 100 milliseconds
+             * @endcode
+             *
+             * @returns std::tuple<Ts...> with the current velocities.
+             */
+            const typename detail::tweentraits<T, Ts...>::velocitiesType velocity() const;
+
+            /**
+             * @brief Calculates and returns the velocity of the tween values at a given progress
+             *
+             * @param progress The progress to evaluate, between 0.0f and 1.0f
+             * @returns std::tuple<Ts...> with the calculated velocities.
+             * @sa velocity
+             */
+            const typename detail::tweentraits<T, Ts...>::velocitiesType peekVelocity(float progress) const;
+
+            /**
+             * @brief Calculates and returns the velocity of the tween values at a given time
+             *
+             * @param time The time to evaluate, between 0 and the total duration
+             * @returns std::tuple<Ts...> with the calculated velocities.
+             * @sa velocity
+             */
+            const typename detail::tweentraits<T, Ts...>::velocitiesType peekVelocity(uint32_t time) const;
+
             /**
              * @brief Returns the current time point of the interpolation.
              *
@@ -572,27 +740,335 @@ namespace tweeny {
              */
             uint16_t point() const;
 
+            /**
+             * @brief Makes the tween repeat itself when stepping past its end.
+             *
+             * When stepping reaches the end of the tween, the remaining delta is carried over into the next cycle, so
+             * no time is lost between cycles. Stepping over several cycles at once is resolved in constant time, with
+             * tween::onLoop callbacks being called once per cycle. Seeking and jumping are relative to the current
+             * cycle.
+             *
+             * **Example**:
+             *
+             * @code
+             * // goes from 0 to 100 three times
+             * auto tween = tweeny::from(0).to(100).during(100).repeat(2);
+             *
+             * // goes from 0 to 100 and back, forever
+             * auto tween = tweeny::from(0).to(100).during(100).repeat(-1).yoyo();
+             * @endcode
+             *
+             * @param count How many times the tween will repeat after its first run. Negative values repeat it forever.
+             * @returns *this
+             * @sa yoyo, onLoop, cycle
+             */
+            tween<T, Ts...> & repeat(int32_t count);
+
+            /**
+             * @brief Makes a repeating tween reverse its direction every other cycle.
+             *
+             * @param enabled Set to false to disable it again
+             * @returns *this
+             * @sa repeat
+             */
+            tween<T, Ts...> & yoyo(bool enabled = true);
+
+            /**
+             * @brief Sets the playback rate of this tween.
+             *
+             * Deltas passed to tween::step are multiplied by this rate. Fractions of duration units are carried over
+             * to the next step, so a rate of `0.5f` stepping by `1` will advance one unit every two steps.
+             *
+             * @param rate A non-negative playback rate. `1.0f` is the normal speed.
+             * @returns *this
+             */
+            tween<T, Ts...> & rate(float rate);
+
+            /**
+             * @brief Returns the playback rate of this tween.
+             *
+             * @returns The playback rate set by tween::rate(float)
+             */
+            float rate() const;
+
+            /**
+             * @brief Makes this tween step polynomial easings with a few additions when it is stepped at a fixed rate.
+             *
+             * When consecutive steps move the tween by the same number of duration units within a point, values
+             * eased by tweeny::easing::linear or any of the quadratic, cubic, quartic and quintic easings are
+             * updated with forward differences instead of evaluating their easing. Differences are computed again
+             * whenever the stride changes, at point boundaries and halfway through `InOut` easings, after a seek and
+             * when the tween is modified, so stepping is exact up to rounding: values stay within a millionth of the
+             * distance between their points of what regular stepping gives.
+             *
+             * Only floating point values are stepped that way, other values and easings are evaluated as usual. With
+             * a playback rate or fractional steps, the tween only benefits while whole units are stepped at a time.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto t = tweeny::from(0.0f, 0.0f).to(640.0f, 480.0f).during(2000).via(tweeny::easing::cubicInOut).fixed();
+             * while (!t.isFinished()) t.step(16); // steady 62.5Hz simulation
+             * @endcode
+             *
+             * @param enabled Set to false to evaluate easings on every step again
+             * @returns *this
+             */
+            tween<T, Ts...> & fixed(bool enabled = true);
+
+            /**
+             * @brief Returns the current cycle of a repeating tween.
+             *
+             * @returns 0 during the first run, 1 during the first repetition and so forth
+             * @sa repeat
+             */
+            uint32_t cycle() const;
+
+            /**
+             * @brief Adds a callback that will be called when a repeating tween starts a new cycle.
+             *
+             * Callbacks follow the same rules of tween::onStep(). They are called once for each cycle boundary crossed
+             * during a tween::step() call, with the tween values after the step.
+             *
+             * @param callback A callback in with the prototype `bool callback(tween<Ts...> & t, Ts...)`
+             * @sa repeat
+             */
+            tween<T, Ts...> & onLoop(typename detail::tweentraits<T, Ts...>::callbackType callback);
+
+            /**
+             * @brief Adds a callback that will be called when a repeating tween starts a new cycle, accepting only the
+             * tween.
+             *
+             * @param callback A callback in the form `bool f(tween<Ts...> & t)`
+             * @sa repeat
+             */
+            tween<T, Ts...> & onLoop(typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback);
+
+            /**
+             * @brief Adds a callback that will be called when a repeating tween starts a new cycle, accepting only the
+             * tween values.
+             *
+             * @param callback A callback in the form `bool f(Ts...)`
+             * @sa repeat
+             */
+            tween<T, Ts...> & onLoop(typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback);
+
+            /**
+             * @brief Adds a callback that will be called when the tween passes over a time point.
+             *
+             * Use cues for events inside a segment, like footstep sounds, instead of checking the time in an onStep
+             * callback. Cues are kept sorted, so that stepping only looks at the ones between the previous and the
+             * new time point.
+             *
+             * A cue is called when the time point is crossed or reached by tween::step, tween::seek or tween::jump,
+             * in any direction and once for every cycle crossed, in the order the tween passes over them. The time
+             * point the tween starts from does not count as crossed. Callbacks follow the same rules of
+             * tween::onStep(), with the tween values after the step, and are suppressed along with them. Cues
+             * should not add or remove other cues.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto walk = tweeny::from(0.0f).to(100.0f).during(1000).repeat(-1);
+             * walk.cue(250, [](float) { playFootstep(); return false; });
+             * walk.cue(750, [](float) { playFootstep(); return false; });
+             * @endcode
+             *
+             * @param time The time point, between 0 and the total duration
+             * @param callback A callback in with the prototype `bool callback(tween<Ts...> & t, Ts...)`
+             * @returns *this
+             */
+            tween<T, Ts...> & cue(uint32_t time, typename detail::tweentraits<T, Ts...>::callbackType callback);
+            tween<T, Ts...> & cue(uint32_t time, typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback); ///< @sa tween::cue(uint32_t time, callbackType callback)
+            tween<T, Ts...> & cue(uint32_t time, typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback); ///< @sa tween::cue(uint32_t time, callbackType callback)
+
+            /**
+             * @brief Binds the tween values to external storage.
+             *
+             * Every time the tween values change (by stepping, seeking or jumping), they are also written to the
+             * memory pointed by each argument. Binding itself writes nothing. This lets a tween write directly into, e.g, a member of your
+             * components, without copying the return value of tween::step yourself. A `nullptr` leaves that value
+             * unbound, so you can bind only some values.
+             *
+             * The pointers must outlive the tween, or be unbound before they become invalid. Copies of a tween keep its
+             * bindings.
+             *
+             * **Example**:
+             *
+             * @code
+             * struct sprite { float x, y; } s;
+             * auto tween = tweeny::from(0.0f, 0.0f).to(100.0f, 50.0f).during(100).bind(&s.x, &s.y);
+             * tween.step(50); // s.x is 50.0f, s.y is 25.0f
+             * @endcode
+             *
+             * @param t, vs Pointers to where each value should be written, or `nullptr`
+             * @returns *this
+             * @sa tweeny::collection::bind
+             */
+            tween<T, Ts...> & bind(T * t, Ts * ... vs);
+
+            /**
+             * @brief Makes this tween publish its values for another thread to read.
+             *
+             * Every time the tween values change, they are also copied into a triple buffer. Another thread can then
+             * call tween::latest() to get the latest published values without locking and without ever seeing
+             * partially updated values, while this tween keeps being stepped. The current values are published right
+             * away.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto tween = tweeny::from(0.0f, 0.0f).to(100.0f, 50.0f).during(1000).publish();
+             *
+             * // simulation thread
+             * tween.step(16);
+             *
+             * // render thread
+             * auto values = tween.latest();
+             * @endcode
+             *
+             * @param enabled Set to false to stop publishing
+             * @returns *this
+             * @sa latest
+             */
+            tween<T, Ts...> & publish(bool enabled = true);
+
+            /**
+             * @brief Returns the values last published by this tween.
+             *
+             * This is safe to call from a thread other than the one stepping the tween, as long as only one thread
+             * calls it, and only after tween::publish was called. The returned reference is valid until the next call.
+             *
+             * @returns std::tuple<Ts...> with the latest published values.
+             * @throws std::logic_error if the tween never published its values
+             * @sa publish
+             */
+            const typename detail::tweentraits<T, Ts...>::valuesType & latest();
+
+            /**
+             * @brief Returns the playback state of this tween: its values, time point, cycle and direction.
+             *
+             * The state is a plain struct, trivially copyable when the tween values are, and much cheaper to copy
+             * than a tween, which owns its points and callbacks. Use it to save and restore tweens many times per
+             * frame, as in rollback networking. It does not include what defines the tween, like its points,
+             * durations, easings, repeats or rate.
+             *
+             * **Example**:
+             *
+             * @code
+             * auto saved = tween.snapshot();
+             * tween.step(16);
+             * tween.restore(saved); // back to where it was
+             * @endcode
+             *
+             * @returns The current state
+             * @sa restore, tweeny::collection::snapshot
+             */
+            stateType snapshot() const;
+
+            /**
+             * @brief Restores a state returned by tween::snapshot.
+             *
+             * No callbacks are called, and awaiting coroutines are not resumed. Bound and published values are
+             * updated.
+             *
+             * @param saved A state of this tween, or of a tween with the same points and durations
+             * @returns *this
+             * @sa snapshot
+             */
+            tween<T, Ts...> & restore(const stateType & saved);
+
+            /**
+             * @brief Returns an object that can be awaited by a C++20 coroutine until this tween finishes.
+             *
+             * The coroutine is resumed from within the tween::step or tween::seek call that finishes the tween. Suspended
+             * coroutines cost nothing while the tween is stepped, other than checking if any of them should be
+             * resumed. If the tween is already finished, the coroutine does not suspend.
+             *
+             * Awaiting coroutines are not copied with the tween, but follow it when it is moved. They are never resumed
+             * if the tween is destroyed first.
+             *
+             * **Example**:
+             *
+             * @code
+             * tweeny::task fadeout(tweeny::tween<float> & fade) {
+             *     co_await fade.finished();
+             *     puts("faded out");
+             * }
+             * @endcode
+             *
+             * @returns An awaitable object
+             * @sa reaches, tweeny::task
+             */
+            detail::awaiter<tween<T, Ts...>> finished();
+
+            /**
+             * @brief Returns an object that can be awaited by a C++20 coroutine until this tween reaches a time point.
+             *
+             * The coroutine is resumed from within the tween::step or tween::seek call that reaches or passes over that
+             * time point, in any direction. If the tween is already at it, the coroutine does not suspend.
+             *
+             * @param time The time point, between 0 and the total duration
+             * @returns An awaitable object
+             * @sa finished, tweeny::task
+             */
+            detail::awaiter<tween<T, Ts...>> reaches(uint32_t time);
+
         private /* member types */:
             using traits = detail::tweentraits<T, Ts...>;
+            friend class collection<T, Ts...>;
+            friend struct detail::roster<tween<T, Ts...>>;
+            friend struct detail::reducer<T, Ts...>;
+            friend struct detail::awaiter<tween<T, Ts...>>;
 
         private /* member variables */:
             uint32_t total = 0; // total runtime
-            uint16_t currentPoint = 0; // current point
-            uint32_t currentProgress = 0; // current progress
+            detail::seat<stateType> state = stateType{ typename traits::valuesType(), 0, 0, 0, 0, 1 }; // everything stepping and seeking changes, see tween::snapshot
             std::vector<detail::tweenpoint<T, Ts...>> points;
-            typename traits::valuesType current;
             std::vector<typename traits::callbackType> onStepCallbacks;
             std::vector<typename traits::callbackType> onSeekCallbacks;
-            int8_t currentDirection = 1;
+            detail::cold<std::vector<typename traits::callbackType>> onLoopCallbacks; // allocated by onLoop
+            int32_t repeats = 0; // extra cycles, negative means forever
+            bool mirrored = false; // odd cycles run backwards
+            float speed = 1.0f; // playback rate
+            typename traits::outputsType outputs; // external storage written by render
+            bool bound = false; // whether any output is set
+            detail::cold<detail::triplebuffer<typename traits::valuesType>> snapshots; // values published to other threads, allocated by publish
+            bool published = false; // whether render publishes values
+            detail::cold<detail::waitlist> waiters; // suspended coroutines, sorted by time, allocated by the first one
+            detail::cold<std::vector<detail::cue<typename traits::callbackType>>> cues; // sorted by time, allocated by cue
+            detail::cold<detail::kick<typename traits::velocitiesType>> kicks; // bumped segment, see tween::retarget
+            detail::cold<detail::stepping<sizeof...(Ts) + 1>> steps; // difference tables, see tween::fixed
 
         private:
             /* member functions */
             tween(T t, Ts... vs);
+            const typename traits::valuesType & elapse(double dt, bool suppressCallbacks);
+            void advance(int32_t dt, bool suppressCallbacks);
             template<size_t I> void interpolate(uint32_t prog, unsigned point, typename traits::valuesType & values, detail::int2type<I>) const;
             void interpolate(uint32_t prog, unsigned point, typename traits::valuesType & values, detail::int2type<0>) const;
+            template<size_t I> void ease(uint32_t prog, unsigned point, typename traits::valuesType & values) const;
+            template<size_t I> void differentiate(uint32_t prog, unsigned point, typename traits::velocitiesType & values, detail::int2type<I>) const;
+            void differentiate(uint32_t prog, unsigned point, typename traits::velocitiesType & values, detail::int2type<0>) const;
             void render(uint32_t p);
+            void present();
+            void difference(uint32_t p);
+            template<size_t I> void difference(uint32_t prog, bool steady, detail::int2type<I>);
+            void difference(uint32_t prog, bool steady, detail::int2type<0>);
+            template<size_t I> void write(detail::int2type<I>);
+            void write(detail::int2type<0>);
             void dispatch(std::vector<typename traits::callbackType> & cbVector);
+            template<typename F> void pass(uint32_t from, uint32_t to, F visit) const;
+            void cross(uint32_t from, uint32_t to);
+            void ring(uint32_t time);
+            template<typename F> void sweep(int64_t from, int64_t to, F cross) const;
+            int64_t unfolded() const;
+            void wait(const detail::waiter & w);
+            void wake(uint32_t from, uint32_t to);
             uint16_t pointAt(uint32_t progress) const;
+            bool bumped(unsigned point) const;
+            template<size_t I> void kick(const typename traits::velocitiesType & velocities, float sign, detail::int2type<I>);
+            void kick(const typename traits::velocitiesType & velocities, float sign, detail::int2type<0>);
     };
 
     /**
@@ -610,6 +1086,8 @@ namespace tweeny {
         public:
             static tween<T> from(T t);
 
+            typedef detail::playback<T> stateType; ///< @sa tween::snapshot
+
         public:
             tween(); ///< @sa tween::tween
             tween<T> & to(T t); ///< @sa tween::to
@@ -619,9 +1097,12 @@ namespace tweeny {
             template<typename... Fs> tween<T> & via(const std::string & easing, Fs... fs); ///< @sa tween::via
             template<typename... Fs> tween<T> & via(const char * easing, Fs... fs); ///< @sa tween::via
             template<typename... Ds> tween<T> & during(Ds... ds); ///< @sa tween::during
+            tween<T> & retarget(T t, uint16_t duration, bool matchVelocity = false); ///< @sa tween::retarget
             const T & step(int32_t dt, bool suppressCallbacks = false); ///< @sa tween::step(int32_t dt, bool suppressCallbacks)
             const T & step(uint32_t dt, bool suppressCallbacks = false); ///< @sa tween::step(uint32_t dt, bool suppressCallbacks)
             const T & step(float dp, bool suppressCallbacks = false); ///< @sa tween::step(float dp, bool suppressCallbacks)
+            template<typename Rep, typename Period>
+            const T & step(std::chrono::duration<Rep, Period> dt, bool suppressCallbacks = false); ///< @sa tween::step(std::chrono::duration<Rep, Period> dt, bool suppressCallbacks)
             const T & seek(float p, bool suppressCallbacks = false); ///< @sa tween::seek(float p, bool suppressCallbacks)
             const T & seek(int32_t d, bool suppressCallbacks = false); ///< @sa tween::seek(int32_t d, bool suppressCallbacks)
             const T & seek(uint32_t d, bool suppressCallbacks = false); ///< @sa tween::seek(uint32_t d, bool suppressCallbacks)
@@ -634,6 +1115,11 @@ namespace tweeny {
             const T & peek() const; ///< @sa tween::peek
             T peek(float progress) const; ///< @sa tween::peek
             T peek(uint32_t time) const; ///< @sa tween::peek
+            T peek(float progress, typename detail::ratetype<T>::type & velocity) const; ///< @sa tween::peek
+            T peek(uint32_t time, typename detail::ratetype<T>::type & velocity) const; ///< @sa tween::peek
+            typename detail::ratetype<T>::type velocity() const; ///< @sa tween::velocity
+            typename detail::ratetype<T>::type peekVelocity(float progress) const; ///< @sa tween::peekVelocity
+            typename detail::ratetype<T>::type peekVelocity(uint32_t time) const; ///< @sa tween::peekVelocity
             uint32_t duration() const; ///< @sa tween::duration
             uint32_t currentTimePoint() const; ///< @sa tween::currenttimepoint
             float progress() const; ///< @sa tween::progress
@@ -643,27 +1129,71 @@ namespace tweeny {
             int direction() const; ///< @sa tween::direction
             const T & jump(size_t point, bool suppressCallbacks = false); ///< @sa tween::jump
             uint16_t point() const; ///< @sa tween::point
+            tween<T> & repeat(int32_t count); ///< @sa tween::repeat
+            tween<T> & yoyo(bool enabled = true); ///< @sa tween::yoyo
+            tween<T> & rate(float rate); ///< @sa tween::rate
+            float rate() const; ///< @sa tween::rate
+            tween<T> & fixed(bool enabled = true); ///< @sa tween::fixed
+            uint32_t cycle() const; ///< @sa tween::cycle
+            tween<T> & onLoop(typename detail::tweentraits<T>::callbackType callback); ///< @sa tween::onLoop
+            tween<T> & onLoop(typename detail::tweentraits<T>::noValuesCallbackType callback); ///< @sa tween::onLoop
+            tween<T> & onLoop(typename detail::tweentraits<T>::noTweenCallbackType callback); ///< @sa tween::onLoop
+            tween<T> & cue(uint32_t time, typename detail::tweentraits<T>::callbackType callback); ///< @sa tween::cue
+            tween<T> & cue(uint32_t time, typename detail::tweentraits<T>::noValuesCallbackType callback); ///< @sa tween::cue
+            tween<T> & cue(uint32_t time, typename detail::tweentraits<T>::noTweenCallbackType callback); ///< @sa tween::cue
+            tween<T> & bind(T * t); ///< @sa tween::bind
+            tween<T> & publish(bool enabled = true); ///< @sa tween::publish
+            const T & latest(); ///< @sa tween::latest
+            stateType snapshot() const; ///< @sa tween::snapshot
+            tween<T> & restore(const stateType & saved); ///< @sa tween::restore
+            detail::awaiter<tween<T>> finished(); ///< @sa tween::finished
+            detail::awaiter<tween<T>> reaches(uint32_t time); ///< @sa tween::reaches
 
         private /* member types */:
             using traits = detail::tweentraits<T>;
+            friend class collection<T>;
+            friend struct detail::roster<tween<T>>;
+            friend struct detail::reducer<T>;
+            friend struct detail::awaiter<tween<T>>;
 
         private /* member variables */:
             uint32_t total = 0; // total runtime
-            uint16_t currentPoint = 0; // current point
-            uint32_t currentProgress = 0; // current progress
+            detail::seat<stateType> state = stateType{ T(), 0, 0, 0, 0, 1 }; // everything stepping and seeking changes, see tween::snapshot
             std::vector<detail::tweenpoint<T>> points;
-            T current;
             std::vector<typename traits::callbackType> onStepCallbacks;
             std::vector<typename traits::callbackType> onSeekCallbacks;
-            int8_t currentDirection = 1;
+            detail::cold<std::vector<typename traits::callbackType>> onLoopCallbacks; // allocated by onLoop
+            int32_t repeats = 0; // extra cycles, negative means forever
+            bool mirrored = false; // odd cycles run backwards
+            float speed = 1.0f; // playback rate
+            T * output = nullptr; // external storage written by render
+            detail::cold<detail::triplebuffer<T>> snapshots; // values published to other threads, allocated by publish
+            bool published = false; // whether render publishes values
+            detail::cold<detail::waitlist> waiters; // suspended coroutines, sorted by time, allocated by the first one
+            detail::cold<std::vector<detail::cue<typename traits::callbackType>>> cues; // sorted by time, allocated by cue
+            detail::cold<detail::kick<typename detail::ratetype<T>::type>> kicks; // bumped segment, see tween::retarget
+            detail::cold<detail::stepping<1>> steps; // difference table, see tween::fixed
 
         private:
             /* member functions */
             tween(T t);
+            const T & elapse(double dt, bool suppressCallbacks);
+            void advance(int32_t dt, bool suppressCallbacks);
             void interpolate(uint32_t prog, unsigned point, T & value) const;
+            void differentiate(uint32_t prog, unsigned point, typename detail::ratetype<T>::type & value) const;
             void render(uint32_t p);
+            void present();
+            void difference(uint32_t p);
             void dispatch(std::vector<typename traits::callbackType> & cbVector);
+            template<typename F> void pass(uint32_t from, uint32_t to, F visit) const;
+            void cross(uint32_t from, uint32_t to);
+            void ring(uint32_t time);
+            template<typename F> void sweep(int64_t from, int64_t to, F cross) const;
+            int64_t unfolded() const;
+            void wait(const detail::waiter & w);
+            void wake(uint32_t from, uint32_t to);
             uint16_t pointAt(uint32_t progress) const;
+            bool bumped(unsigned point) const;
     };
 }
 
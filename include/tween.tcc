@@ -29,6 +29,9 @@
 #ifndef TWEENY_TWEEN_TCC
 #define TWEENY_TWEEN_TCC
 
+#include <cmath>
+#include <algorithm>
+
 #include "tween.h"
 #include "dispatcher.h"
 
@@ -41,14 +44,16 @@ namespace tweeny {
         }
     }
 
-    template<typename T, typename... Ts> inline tween<T, Ts...> tween<T, Ts...>::from(T t, Ts... vs) { return tween<T, Ts...>(t, vs...); }
+    template<typename T, typename... Ts> inline tween<T, Ts...> tween<T, Ts...>::from(T t, Ts... vs) { return tween<T, Ts...>(std::move(t), std::move(vs)...); }
     template<typename T, typename... Ts> inline tween<T, Ts...>::tween() { }
     template<typename T, typename... Ts> inline tween<T, Ts...>::tween(T t, Ts... vs) {
-        points.emplace_back(t, vs...);
+        points.emplace_back(std::move(t), std::move(vs)...);
+        state->current = points.front().values;
     }
 
     template<typename T, typename... Ts> inline tween<T, Ts...> & tween<T, Ts...>::to(T t, Ts... vs) {
-        points.emplace_back(t, vs...);
+        points.emplace_back(std::move(t), std::move(vs)...);
+        kicks.object.reset();
         return *this;
     }
 
@@ -56,6 +61,8 @@ namespace tweeny {
     template<typename... Fs>
     inline tween<T, Ts...> & tween<T, Ts...>::via(Fs... vs) {
         points.at(points.size() - 2).via(vs...);
+        kicks.object.reset();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
@@ -63,6 +70,8 @@ namespace tweeny {
     template<typename... Fs>
     inline tween<T, Ts...> & tween<T, Ts...>::via(int index, Fs... vs) {
         points.at(static_cast<size_t>(index)).via(vs...);
+        kicks.object.reset();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
@@ -156,20 +165,87 @@ namespace tweeny {
     inline tween<T, Ts...> & tween<T, Ts...>::during(Ds... ds) {
         total = 0;
         points.at(points.size() - 2).during(ds...);
+        kicks.object.reset();
+        for (detail::tweenpoint<T, Ts...> & p : points) {
+            total += p.duration();
+            p.stacked = total;
+        }
+        if (steps.object) steps.object->clear();
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::retarget(T t, Ts... vs, uint16_t duration, bool matchVelocity) {
+        if (points.size() < 2) {
+            state->current = points.front().values;
+            points.emplace_back(t, vs...);
+        }
+        typename traits::velocitiesType velocities;
+        if (matchVelocity) velocities = velocity();
+        float sign = state->direction * (mirrored && (state->cycle & 1u) ? -1.0f : 1.0f); // where values were heading
+
+        /* The running segment now starts from the current values, over what was left of it, and the last point holds
+         * the new ones. The other points are kept as they are, so nothing is allocated or moved, and they are still
+         * reached when they would have been */
+        auto & start = points[state->point];
+        auto & tail = points[points.size() - 2];
+        uint32_t elapsed = state->progress - (start.stacked - start.duration());
+        start.values = state->current;
+        points.back().values = typename traits::valuesType{ std::move(t), std::move(vs)... };
+        if (&start != &tail) {
+            for (uint16_t & d : start.durations) d = static_cast<uint16_t>(d > elapsed + 1 ? d - elapsed : 1);
+        }
+        tail.during(duration);
+        total = 0;
         for (detail::tweenpoint<T, Ts...> & p : points) {
             total += p.duration();
             p.stacked = total;
         }
+
+        kicks.object.reset();
+        if (matchVelocity && sign > 0 && start.duration() > 0) { // a tween heading back leaves the segment at once
+            kicks.object.reset(new detail::kick<typename traits::velocitiesType>());
+            kicks.object->point = state->point;
+            kick(velocities, sign, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        }
+        state->progress = start.stacked - start.duration();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
+    template<typename T, typename... Ts>
+    template<size_t I>
+    inline void tween<T, Ts...>::kick(const typename traits::velocitiesType & velocities, float sign, detail::int2type<I>) {
+        auto & p = points[kicks.object->point];
+        auto slope = p.template slope<I>(0.0f, std::get<I>(p.values), std::get<I>(points[kicks.object->point + 1u].values));
+        std::get<I>(kicks.object->heights) = detail::lift(detail::scale(std::get<I>(velocities), sign), p.duration(I), slope);
+        kick(velocities, sign, detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::kick(const typename traits::velocitiesType & velocities, float sign, detail::int2type<0>) {
+        auto & p = points[kicks.object->point];
+        auto slope = p.template slope<0>(0.0f, std::get<0>(p.values), std::get<0>(points[kicks.object->point + 1u].values));
+        std::get<0>(kicks.object->heights) = detail::lift(detail::scale(std::get<0>(velocities), sign), p.duration(0), slope);
+    }
+
     template<typename T, typename... Ts>
     inline const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::step(int32_t dt, bool suppress) {
-        dt *= currentDirection;
-        seek(currentProgress + dt, true);
+        if (speed != 1.0f || state->carry != 0) return elapse(dt, suppress);
+        advance(dt * state->direction, suppress);
         if (!suppress)
             dispatch(onStepCallbacks);
-        return current;
+        return state->current;
+    }
+
+    template<typename T, typename... Ts>
+    inline const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::elapse(double dt, bool suppress) {
+        double scaled = dt * speed + state->carry;
+        double whole = std::floor(scaled);
+        state->carry = scaled - whole;
+        advance(static_cast<int32_t>(whole) * state->direction, suppress);
+        if (!suppress) dispatch(onStepCallbacks);
+        return state->current;
     }
 
     template<typename T, typename... Ts>
@@ -179,16 +255,26 @@ namespace tweeny {
 
     template<typename T, typename... Ts>
     inline const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::step(float dp, bool suppress) {
-        return step(static_cast<int32_t>(dp * total), suppress);
+        return elapse(static_cast<double>(dp) * total, suppress);
+    }
+
+    template<typename T, typename... Ts>
+    template<typename Rep, typename Period>
+    inline const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::step(std::chrono::duration<Rep, Period> dt, bool suppress) {
+        typedef std::ratio_divide<Period, std::milli> ratio;
+        return elapse(static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den), suppress);
     }
 
     template<typename T, typename... Ts>
     inline const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::seek(uint32_t p, bool suppress) {
         p = detail::clip(p, 0u, total);
-        currentProgress = p;
+        uint32_t from = state->progress;
+        state->progress = p;
         render(p);
         if (!suppress) dispatch(onSeekCallbacks);
-        return current;
+        if (!suppress && cues.object) cross(from, p);
+        if (waiters.object) wake(from, p);
+        return state->current;
     }
 
     template<typename T, typename... Ts>
@@ -201,6 +287,42 @@ namespace tweeny {
         return seek(static_cast<int32_t>(p * total), suppress);
     }
 
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::advance(int32_t dt, bool suppress) {
+        if (repeats == 0 || total == 0) {
+            uint32_t from = state->progress;
+            seek(static_cast<uint32_t>(detail::clip<int64_t>(int64_t(state->progress) + dt, 0, total)), true);
+            if (!suppress && cues.object) cross(from, state->progress);
+            return;
+        }
+
+        /* unfolds every cycle into a single timeline, so that any delta is resolved at once */
+        int64_t length = total;
+        int64_t position = unfolded() + dt;
+        int64_t origin = position - dt;
+        if (position < 0) position = 0;
+
+        uint32_t next;
+        int64_t local;
+        if (repeats > 0 && position >= (int64_t(repeats) + 1) * length) {
+            next = static_cast<uint32_t>(repeats);
+            local = length;
+            position = (int64_t(repeats) + 1) * length;
+        } else {
+            next = static_cast<uint32_t>(position / length);
+            local = position - next * length;
+        }
+        if (mirrored && (next & 1u)) local = length - local;
+
+        uint32_t wraps = next > state->cycle ? next - state->cycle : state->cycle - next;
+        state->cycle = next;
+        if (wraps > 0) kicks.object.reset(); // a retargeted segment starts at the matched velocity only once
+        seek(static_cast<uint32_t>(local), true);
+        if (wraps > 0 && waiters.object) wake(0, total); // a wrap passes over every time point
+        if (!suppress && cues.object) sweep(origin, position, [this](uint32_t a, uint32_t b) { cross(a, b); });
+        if (!suppress && onLoopCallbacks.object) for (; wraps > 0; --wraps) dispatch(*onLoopCallbacks.object);
+    }
+
     template<typename T, typename... Ts>
     inline uint32_t tween<T, Ts...>::duration() const {
         return total;
@@ -209,29 +331,193 @@ namespace tweeny {
     template<typename T, typename... Ts>
     template<size_t I>
     inline void tween<T, Ts...>::interpolate(uint32_t prog, unsigned point, typename traits::valuesType & values, detail::int2type<I>) const {
+        ease<I>(prog, point, values);
+        interpolate(prog, point, values, detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::interpolate(uint32_t prog, unsigned point, typename traits::valuesType & values, detail::int2type<0>) const {
+        ease<0>(prog, point, values);
+    }
+
+    template<typename T, typename... Ts>
+    template<size_t I>
+    inline void tween<T, Ts...>::ease(uint32_t prog, unsigned point, typename traits::valuesType & values) const {
         auto & p = points.at(point);
         auto pointDuration = uint32_t(p.duration() - (p.stacked - prog));
         float pointTotal = static_cast<float>(pointDuration) / static_cast<float>(p.duration(I));
         if (pointTotal > 1.0f) pointTotal = 1.0f;
-        auto easing = std::get<I>(p.easings);
-        std::get<I>(values) = easing(pointTotal, std::get<I>(p.values), std::get<I>(points.at(point+1).values));
-        interpolate(prog, point, values, detail::int2type<I-1>{ });
+        std::get<I>(values) = p.template ease<I>(pointTotal, std::get<I>(p.values), std::get<I>(points.at(point+1).values));
+        if (bumped(point)) std::get<I>(values) = detail::bump(std::get<I>(values), std::get<I>(kicks.object->heights), pointTotal);
     }
 
     template<typename T, typename... Ts>
-    inline void tween<T, Ts...>::interpolate(uint32_t prog, unsigned point, typename traits::valuesType & values, detail::int2type<0>) const {
+    template<size_t I>
+    inline void tween<T, Ts...>::differentiate(uint32_t prog, unsigned point, typename traits::velocitiesType & values, detail::int2type<I>) const {
         auto & p = points.at(point);
         auto pointDuration = uint32_t(p.duration() - (p.stacked - prog));
-        float pointTotal = static_cast<float>(pointDuration) / static_cast<float>(p.duration(0));
+        float duration = static_cast<float>(p.duration(I));
+        float pointTotal = static_cast<float>(pointDuration) / duration;
+        float rate = (duration > 0 && pointTotal <= 1.0f) ? 1.0f / duration : 0.0f;
         if (pointTotal > 1.0f) pointTotal = 1.0f;
-        auto easing = std::get<0>(p.easings);
-        std::get<0>(values) = easing(pointTotal, std::get<0>(p.values), std::get<0>(points.at(point+1).values));
+        auto slope = p.template slope<I>(pointTotal, std::get<I>(p.values), std::get<I>(points.at(point+1).values));
+        if (bumped(point)) slope = detail::bumpSlope(slope, std::get<I>(kicks.object->heights), pointTotal);
+        std::get<I>(values) = detail::scale(slope, rate);
+        differentiate(prog, point, values, detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::differentiate(uint32_t prog, unsigned point, typename traits::velocitiesType & values, detail::int2type<0>) const {
+        auto & p = points.at(point);
+        auto pointDuration = uint32_t(p.duration() - (p.stacked - prog));
+        float duration = static_cast<float>(p.duration(0));
+        float pointTotal = static_cast<float>(pointDuration) / duration;
+        float rate = (duration > 0 && pointTotal <= 1.0f) ? 1.0f / duration : 0.0f;
+        if (pointTotal > 1.0f) pointTotal = 1.0f;
+        auto slope = p.template slope<0>(pointTotal, std::get<0>(p.values), std::get<0>(points.at(point+1).values));
+        if (bumped(point)) slope = detail::bumpSlope(slope, std::get<0>(kicks.object->heights), pointTotal);
+        std::get<0>(values) = detail::scale(slope, rate);
     }
 
     template<typename T, typename... Ts>
     inline void tween<T, Ts...>::render(uint32_t p) {
-        currentPoint = pointAt(p);
-        interpolate(p, currentPoint, current, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        state->point = pointAt(p);
+        if (steps.object) difference(p);
+        else interpolate(p, state->point, state->current, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        present();
+    }
+
+    /* Writes the current values to the bound outputs and publishes them */
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::present() {
+        if (bound) write(detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        if (published) snapshots.object->write(state->current);
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::difference(uint32_t p) {
+        auto & s = *steps.object;
+        bool steady = s.follows(p, state->point) && !bumped(state->point);
+        difference(p, steady, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+    }
+
+    template<typename T, typename... Ts>
+    template<size_t I>
+    inline void tween<T, Ts...>::difference(uint32_t prog, bool steady, detail::int2type<I>) {
+        typedef typename std::tuple_element<I, typename traits::valuesType>::type valueType;
+        auto & s = *steps.object;
+        auto & table = s.tables[I];
+        auto & p = points[state->point];
+        auto c = std::get<I>(p.curves);
+        if (steady && table.left > 0)
+            detail::place(std::get<I>(state->current), std::get<I>(p.values), std::get<I>(points[state->point + 1].values), table.next());
+        else {
+            ease<I>(prog, state->point, state->current);
+            if (std::is_floating_point<valueType>::value && c && c->shape && s.stride != 0 && !bumped(state->point))
+                table.start(*c->shape, uint32_t(p.duration() - (p.stacked - prog)), s.stride, p.duration(I));
+            else table.left = 0;
+        }
+        difference(prog, steady, detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::difference(uint32_t prog, bool steady, detail::int2type<0>) {
+        typedef typename std::tuple_element<0, typename traits::valuesType>::type valueType;
+        auto & s = *steps.object;
+        auto & table = s.tables[0];
+        auto & p = points[state->point];
+        auto c = std::get<0>(p.curves);
+        if (steady && table.left > 0)
+            detail::place(std::get<0>(state->current), std::get<0>(p.values), std::get<0>(points[state->point + 1].values), table.next());
+        else {
+            ease<0>(prog, state->point, state->current);
+            if (std::is_floating_point<valueType>::value && c && c->shape && s.stride != 0 && !bumped(state->point))
+                table.start(*c->shape, uint32_t(p.duration() - (p.stacked - prog)), s.stride, p.duration(0));
+            else table.left = 0;
+        }
+    }
+
+    template<typename T, typename... Ts>
+    template<size_t I>
+    inline void tween<T, Ts...>::write(detail::int2type<I>) {
+        auto output = std::get<I>(outputs);
+        if (output) *output = std::get<I>(state->current);
+        write(detail::int2type<I-1>{ });
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::write(detail::int2type<0>) {
+        auto output = std::get<0>(outputs);
+        if (output) *output = std::get<0>(state->current);
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::bind(T * t, Ts * ... vs) {
+        outputs = std::make_tuple(t, vs...);
+        bound = false;
+        for (bool b : {t != nullptr, (vs != nullptr)...}) bound = bound || b;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::publish(bool enabled) {
+        published = enabled;
+        if (!published) return *this;
+        if (!snapshots.object) snapshots.object.reset(new detail::triplebuffer<typename traits::valuesType>());
+        snapshots.object->write(state->current);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::latest() {
+        if (!snapshots.object) throw std::logic_error("tweeny::tween::latest: the tween never published its values");
+        return snapshots.object->read();
+    }
+
+    template<typename T, typename... Ts>
+    typename tween<T, Ts...>::stateType tween<T, Ts...>::snapshot() const {
+        return *state;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::restore(const stateType & saved) {
+        *state = saved;
+        present();
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    detail::awaiter<tween<T, Ts...>> tween<T, Ts...>::finished() {
+        return { *this, detail::waiter::finished };
+    }
+
+    template<typename T, typename... Ts>
+    detail::awaiter<tween<T, Ts...>> tween<T, Ts...>::reaches(uint32_t time) {
+        return { *this, detail::clip(time, 0u, total) };
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::wait(const detail::waiter & w) {
+        if (!waiters.object) waiters.object.reset(new detail::waitlist());
+        auto & list = *waiters.object;
+        list.insert(std::upper_bound(list.begin(), list.end(), w), w);
+    }
+
+    template<typename T, typename... Ts>
+    inline void tween<T, Ts...>::wake(uint32_t from, uint32_t to) {
+        if (from > to) std::swap(from, to);
+        auto & list = *waiters.object;
+        auto first = std::lower_bound(list.begin(), list.end(), detail::waiter{from, nullptr, nullptr, nullptr});
+        auto last = std::upper_bound(first, list.end(), detail::waiter{to, nullptr, nullptr, nullptr});
+        std::vector<detail::waiter> ready(first, last);
+        list.erase(first, last);
+        if (isFinished()) {
+            auto sentinel = std::lower_bound(list.begin(), list.end(), detail::waiter{detail::waiter::finished, nullptr, nullptr, nullptr});
+            ready.insert(ready.end(), sentinel, list.end());
+            list.erase(sentinel, list.end());
+        }
+        /* resumed coroutines may await this tween again, so waiters is updated before resuming any of them */
+        for (auto & w : ready) w.resume(w.handle);
     }
 
     template<typename T, typename... Ts>
@@ -242,13 +528,13 @@ namespace tweeny {
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::onStep(typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback) {
-        onStepCallbacks.push_back([callback](tween<T, Ts...> & t, T, Ts...) { return callback(t); });
+        onStepCallbacks.push_back([callback](tween<T, Ts...> & t, const T &, const Ts &...) { return callback(t); });
         return *this;
     }
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::onStep(typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback) {
-        onStepCallbacks.push_back([callback](tween<T, Ts...> &, T t, Ts... vs) { return callback(t, vs...); });
+        onStepCallbacks.push_back([callback](tween<T, Ts...> &, const T & t, const Ts &... vs) { return callback(t, vs...); });
         return *this;
     }
 
@@ -260,13 +546,13 @@ namespace tweeny {
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::onSeek(typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback) {
-        onSeekCallbacks.push_back([callback](tween<T, Ts...> & t, T, Ts...) { return callback(t); });
+        onSeekCallbacks.push_back([callback](tween<T, Ts...> & t, const T &, const Ts &...) { return callback(t); });
         return *this;
     }
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::onSeek(typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback) {
-        onSeekCallbacks.push_back([callback](tween<T, Ts...> &, T t, Ts... vs) { return callback(t, vs...); });
+        onSeekCallbacks.push_back([callback](tween<T, Ts...> &, const T & t, const Ts &... vs) { return callback(t, vs...); });
         return *this;
     }
 
@@ -275,7 +561,7 @@ namespace tweeny {
         std::vector<size_t> dismissed;
         for (size_t i = 0; i < cbVector.size(); ++i) {
             auto && cb = cbVector[i];
-            bool dismiss = detail::call<bool>(cb, std::tuple_cat(std::make_tuple(std::ref(*this)), current));
+            bool dismiss = detail::spread<bool>(cb, *this, state->current, typename detail::gens<sizeof...(Ts) + 1>::type());
             if (dismiss) dismissed.push_back(i);
         }
 
@@ -290,7 +576,7 @@ namespace tweeny {
 
     template<typename T, typename... Ts>
     const typename detail::tweentraits<T, Ts...>::valuesType & tween<T, Ts...>::peek() const {
-      return current;
+      return state->current;
     }
 
     template<typename T, typename... Ts>
@@ -308,36 +594,68 @@ namespace tweeny {
         return values;
     }
 
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::valuesType tween<T, Ts...>::peek(float progress, typename detail::tweentraits<T, Ts...>::velocitiesType & velocities) const {
+        return peek(static_cast<uint32_t>(progress * total), velocities);
+    }
+
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::valuesType tween<T, Ts...>::peek(uint32_t time, typename detail::tweentraits<T, Ts...>::velocitiesType & velocities) const {
+        typename detail::tweentraits<T, Ts...>::valuesType values;
+        auto point = pointAt(time);
+        interpolate(time, point, values, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        differentiate(time, point, velocities, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        return values;
+    }
+
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::velocitiesType tween<T, Ts...>::velocity() const {
+        return peekVelocity(state->progress);
+    }
+
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::velocitiesType tween<T, Ts...>::peekVelocity(float progress) const {
+        return peekVelocity(static_cast<uint32_t>(progress * total));
+    }
+
+    template<typename T, typename... Ts>
+    const typename detail::tweentraits<T, Ts...>::velocitiesType tween<T, Ts...>::peekVelocity(uint32_t time) const {
+        typename detail::tweentraits<T, Ts...>::velocitiesType velocities;
+        differentiate(time, pointAt(time), velocities, detail::int2type<sizeof...(Ts) - 1 + 1 /* +1 for the T */>{ });
+        return velocities;
+    }
+
     template<typename T, typename... Ts>
     uint32_t tween<T, Ts...>::currentTimePoint() const {
-        return currentProgress;
+        return state->progress;
     }
 
     template<typename T, typename... Ts>
     float tween<T, Ts...>::progress() const {
-        return static_cast<float>(currentProgress) / static_cast<float>(total);
+        return static_cast<float>(state->progress) / static_cast<float>(total);
     }
 
     template<typename T, typename... Ts>
     bool tween<T, Ts...>::isFinished() const {
-        return currentProgress == total;
+        if (repeats < 0 || state->cycle != static_cast<uint32_t>(repeats)) return false;
+        return (mirrored && (state->cycle & 1u)) ? state->progress == 0 : state->progress == total;
     }
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::forward() {
-        currentDirection = 1;
+        state->direction = 1;
         return *this;
     }
 
     template<typename T, typename... Ts>
     tween<T, Ts...> & tween<T, Ts...>::backward() {
-        currentDirection = -1;
+        state->direction = -1;
         return *this;
     }
 
     template<typename T, typename... Ts>
     int tween<T, Ts...>::direction() const {
-        return currentDirection;
+        return state->direction;
     }
 
     template<typename T, typename... Ts>
@@ -346,8 +664,151 @@ namespace tweeny {
         return seek(static_cast<int32_t>(points.at(p).stacked), suppress);
     }
 
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::repeat(int32_t count) {
+        repeats = count;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::yoyo(bool enabled) {
+        mirrored = enabled;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::rate(float rate) {
+        speed = rate;
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    float tween<T, Ts...>::rate() const {
+        return speed;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::fixed(bool enabled) {
+        steps.object.reset(enabled ? new detail::stepping<sizeof...(Ts) + 1>() : nullptr);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    uint32_t tween<T, Ts...>::cycle() const {
+        return state->cycle;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::onLoop(typename detail::tweentraits<T, Ts...>::callbackType callback) {
+        if (!onLoopCallbacks.object) onLoopCallbacks.object.reset(new std::vector<typename traits::callbackType>());
+        onLoopCallbacks.object->push_back(callback);
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::onLoop(typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback) {
+        return onLoop(typename traits::callbackType([callback](tween<T, Ts...> & t, const T &, const Ts &...) { return callback(t); }));
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::onLoop(typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback) {
+        return onLoop(typename traits::callbackType([callback](tween<T, Ts...> &, const T & t, const Ts &... vs) { return callback(t, vs...); }));
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::cue(uint32_t time, typename detail::tweentraits<T, Ts...>::callbackType callback) {
+        detail::cue<typename traits::callbackType> c{ time, callback };
+        if (!cues.object) cues.object.reset(new std::vector<detail::cue<typename traits::callbackType>>());
+        auto & list = *cues.object;
+        auto at = std::upper_bound(list.begin(), list.end(), time, [](uint32_t t, const detail::cue<typename traits::callbackType> & c) {
+            return t < c.time;
+        });
+        list.insert(at, std::move(c));
+        return *this;
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::cue(uint32_t time, typename detail::tweentraits<T, Ts...>::noValuesCallbackType callback) {
+        return cue(time, typename traits::callbackType([callback](tween<T, Ts...> & t, const T &, const Ts &...) { return callback(t); }));
+    }
+
+    template<typename T, typename... Ts>
+    tween<T, Ts...> & tween<T, Ts...>::cue(uint32_t time, typename detail::tweentraits<T, Ts...>::noTweenCallbackType callback) {
+        return cue(time, typename traits::callbackType([callback](tween<T, Ts...> &, const T & t, const Ts &... vs) { return callback(t, vs...); }));
+    }
+
+    template<typename T, typename... Ts>
+    template<typename F>
+    void tween<T, Ts...>::pass(uint32_t from, uint32_t to, F visit) const {
+        if (from == to) return;
+        auto & list = *cues.object;
+        auto before = [](const detail::cue<typename traits::callbackType> & c, uint32_t t) { return c.time < t; };
+        auto after = [](uint32_t t, const detail::cue<typename traits::callbackType> & c) { return t < c.time; };
+
+        /* Forwards, cues in (from, to] are crossed, and backwards, cues in [to, from) */
+        size_t first, last;
+        if (from < to) {
+            first = std::upper_bound(list.begin(), list.end(), from, after) - list.begin();
+            last = std::upper_bound(list.begin() + first, list.end(), to, after) - list.begin();
+        } else {
+            first = std::lower_bound(list.begin(), list.end(), to, before) - list.begin();
+            last = std::lower_bound(list.begin() + first, list.end(), from, before) - list.begin();
+        }
+        for (size_t k = 0; k < last - first; ++k) visit(from < to ? first + k : last - 1 - k);
+    }
+
+    template<typename T, typename... Ts>
+    void tween<T, Ts...>::cross(uint32_t from, uint32_t to) {
+        auto & list = *cues.object;
+        std::vector<size_t> dismissed;
+        pass(from, to, [this, &list, &dismissed](size_t i) {
+            if (detail::spread<bool>(list[i].callback, *this, state->current, typename detail::gens<sizeof...(Ts) + 1>::type())) dismissed.push_back(i);
+        });
+        std::sort(dismissed.begin(), dismissed.end());
+        for (size_t i = dismissed.size(); i-- > 0;) list.erase(list.begin() + dismissed[i]);
+    }
+
+    template<typename T, typename... Ts>
+    void tween<T, Ts...>::ring(uint32_t time) {
+        auto & list = *cues.object;
+        auto at = [](const detail::cue<typename traits::callbackType> & c, uint32_t t) { return c.time < t; };
+        size_t i = std::lower_bound(list.begin(), list.end(), time, at) - list.begin();
+        while (i < list.size() && list[i].time == time) {
+            if (detail::spread<bool>(list[i].callback, *this, state->current, typename detail::gens<sizeof...(Ts) + 1>::type())) list.erase(list.begin() + static_cast<std::ptrdiff_t>(i));
+            else ++i;
+        }
+    }
+
+    template<typename T, typename... Ts>
+    template<typename F>
+    void tween<T, Ts...>::sweep(int64_t from, int64_t to, F cross) const {
+        /* Splits a move over the unfolded timeline of a repeating tween into moves inside each cycle */
+        int64_t length = total;
+        if (from < to) {
+            for (int64_t k = from / length; k * length < to; ++k) {
+                int64_t a = std::max(from, k * length) - k * length;
+                int64_t b = std::min(to, (k + 1) * length) - k * length;
+                if (mirrored && (k & 1)) { a = length - a; b = length - b; }
+                cross(static_cast<uint32_t>(a), static_cast<uint32_t>(b));
+            }
+        } else {
+            for (int64_t k = (from - 1) / length; k >= 0 && (k + 1) * length > to; --k) {
+                int64_t a = std::min(from, (k + 1) * length) - k * length;
+                int64_t b = std::max(to, k * length) - k * length;
+                if (mirrored && (k & 1)) { a = length - a; b = length - b; }
+                cross(static_cast<uint32_t>(a), static_cast<uint32_t>(b));
+            }
+        }
+    }
+
+    template<typename T, typename... Ts>
+    inline int64_t tween<T, Ts...>::unfolded() const {
+        bool reversed = mirrored && (state->cycle & 1u);
+        return int64_t(state->cycle) * total + (reversed ? total - state->progress : state->progress);
+    }
+
     template<typename T, typename... Ts> inline uint16_t tween<T, Ts...>::point() const {
-        return currentPoint;
+        return state->point;
     }
 
     template<typename T, typename... Ts> inline uint16_t tween<T, Ts...>::pointAt(uint32_t progress) const {
@@ -357,6 +818,10 @@ namespace tweeny {
         if (point > 0 && progress <= points.at(point - 1u).stacked) point--;
         return point;
     }
+
+    template<typename T, typename... Ts> inline bool tween<T, Ts...>::bumped(unsigned point) const {
+        return kicks.object && kicks.object->point == point;
+    }
 }
 
 #endif //TWEENY_TWEEN_TCC
@@ -29,18 +29,22 @@
 #ifndef TWEENY_TWEENONE_TCC
 #define TWEENY_TWEENONE_TCC
 
+#include <algorithm>
+
 #include "tween.h"
 #include "dispatcher.h"
 
 namespace tweeny {
-    template<typename T> inline tween<T> tween<T>::from(T t) { return tween<T>(t); }
+    template<typename T> inline tween<T> tween<T>::from(T t) { return tween<T>(std::move(t)); }
     template<typename T> inline tween<T>::tween() { }
     template<typename T> inline tween<T>::tween(T t) {
-        points.emplace_back(t);
+        points.emplace_back(std::move(t));
+        state->current = std::get<0>(points.front().values);
     }
 
     template<typename T> inline tween<T> & tween<T>::to(T t) {
-        points.emplace_back(t);
+        points.emplace_back(std::move(t));
+        kicks.object.reset();
         return *this;
     }
 
@@ -48,6 +52,8 @@ namespace tweeny {
     template<typename... Fs>
     inline tween<T> & tween<T>::via(Fs... vs) {
         points.at(points.size() - 2).via(vs...);
+        kicks.object.reset();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
@@ -55,6 +61,8 @@ namespace tweeny {
     template<typename... Fs>
     inline tween<T> & tween<T>::via(int index, Fs... vs) {
         points.at(static_cast<size_t>(index)).via(vs...);
+        kicks.object.reset();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
@@ -148,19 +156,70 @@ namespace tweeny {
     inline tween<T> & tween<T>::during(Ds... ds) {
         total = 0;
         points.at(points.size() - 2).during(ds...);
+        kicks.object.reset();
         for (detail::tweenpoint<T> & p : points) {
             total += p.duration();
             p.stacked = total;
         }
+        if (steps.object) steps.object->clear();
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::retarget(T t, uint16_t duration, bool matchVelocity) {
+        if (points.size() < 2) {
+            state->current = std::get<0>(points.front().values);
+            points.emplace_back(t);
+        }
+        typename detail::ratetype<T>::type v = matchVelocity ? velocity() : typename detail::ratetype<T>::type();
+        float sign = state->direction * (mirrored && (state->cycle & 1u) ? -1.0f : 1.0f); // where the value was heading
+
+        /* The running segment now starts from the current value, over what was left of it, and the last point holds
+         * the new one. The other points are kept as they are, so nothing is allocated or moved, and they are still
+         * reached when they would have been */
+        auto & start = points[state->point];
+        auto & tail = points[points.size() - 2];
+        uint32_t elapsed = state->progress - (start.stacked - start.duration());
+        std::get<0>(start.values) = state->current;
+        std::get<0>(points.back().values) = std::move(t);
+        if (&start != &tail) {
+            for (uint16_t & d : start.durations) d = static_cast<uint16_t>(d > elapsed + 1 ? d - elapsed : 1);
+        }
+        tail.during(duration);
+        total = 0;
+        for (detail::tweenpoint<T> & p : points) {
+            total += p.duration();
+            p.stacked = total;
+        }
+
+        kicks.object.reset();
+        if (matchVelocity && sign > 0 && start.duration() > 0) { // a tween heading back leaves the segment at once
+            auto slope = start.template slope<0>(0.0f, state->current, std::get<0>(points[state->point + 1u].values));
+            kicks.object.reset(new detail::kick<typename detail::ratetype<T>::type>());
+            kicks.object->point = state->point;
+            kicks.object->heights = detail::lift(detail::scale(v, sign), start.duration(), slope);
+        }
+        state->progress = start.stacked - start.duration();
+        if (steps.object) steps.object->clear();
         return *this;
     }
 
     template<typename T>
     inline const T & tween<T>::step(int32_t dt, bool suppress) {
-        dt *= currentDirection;
-        seek(currentProgress + dt, true);
+        if (speed != 1.0f || state->carry != 0) return elapse(dt, suppress);
+        advance(dt * state->direction, suppress);
         if (!suppress) dispatch(onStepCallbacks);
-        return current;
+        return state->current;
+    }
+
+    template<typename T>
+    inline const T & tween<T>::elapse(double dt, bool suppress) {
+        double scaled = dt * speed + state->carry;
+        double whole = std::floor(scaled);
+        state->carry = scaled - whole;
+        advance(static_cast<int32_t>(whole) * state->direction, suppress);
+        if (!suppress) dispatch(onStepCallbacks);
+        return state->current;
     }
 
     template<typename T>
@@ -170,7 +229,14 @@ namespace tweeny {
 
     template<typename T>
     inline const T & tween<T>::step(float dp, bool suppress) {
-        return step(static_cast<int32_t>(dp * total), suppress);
+        return elapse(static_cast<double>(dp) * total, suppress);
+    }
+
+    template<typename T>
+    template<typename Rep, typename Period>
+    inline const T & tween<T>::step(std::chrono::duration<Rep, Period> dt, bool suppress) {
+        typedef std::ratio_divide<Period, std::milli> ratio;
+        return elapse(static_cast<double>(dt.count()) * (static_cast<double>(ratio::num) / ratio::den), suppress);
     }
 
     template<typename T>
@@ -181,10 +247,13 @@ namespace tweeny {
     template<typename T>
     inline const T & tween<T>::seek(int32_t t, bool suppress) {
         t = detail::clip(t, 0, (int32_t) total);
-        currentProgress = t;
+        uint32_t from = state->progress;
+        state->progress = t;
         render(t);
         if (!suppress) dispatch(onSeekCallbacks);
-        return current;
+        if (!suppress && cues.object) cross(from, static_cast<uint32_t>(t));
+        if (waiters.object) wake(from, static_cast<uint32_t>(t));
+        return state->current;
     }
 
     template<typename T>
@@ -192,6 +261,134 @@ namespace tweeny {
         return seek(static_cast<int32_t>(t), suppress);
     }
 
+    template<typename T>
+    inline void tween<T>::advance(int32_t dt, bool suppress) {
+        if (repeats == 0 || total == 0) {
+            uint32_t from = state->progress;
+            seek(static_cast<uint32_t>(detail::clip<int64_t>(int64_t(state->progress) + dt, 0, total)), true);
+            if (!suppress && cues.object) cross(from, state->progress);
+            return;
+        }
+
+        /* unfolds every cycle into a single timeline, so that any delta is resolved at once */
+        int64_t length = total;
+        int64_t position = unfolded() + dt;
+        int64_t origin = position - dt;
+        if (position < 0) position = 0;
+
+        uint32_t next;
+        int64_t local;
+        if (repeats > 0 && position >= (int64_t(repeats) + 1) * length) {
+            next = static_cast<uint32_t>(repeats);
+            local = length;
+            position = (int64_t(repeats) + 1) * length;
+        } else {
+            next = static_cast<uint32_t>(position / length);
+            local = position - next * length;
+        }
+        if (mirrored && (next & 1u)) local = length - local;
+
+        uint32_t wraps = next > state->cycle ? next - state->cycle : state->cycle - next;
+        state->cycle = next;
+        if (wraps > 0) kicks.object.reset(); // a retargeted segment starts at the matched velocity only once
+        seek(static_cast<uint32_t>(local), true);
+        if (wraps > 0 && waiters.object) wake(0, total); // a wrap passes over every time point
+        if (!suppress && cues.object) sweep(origin, position, [this](uint32_t a, uint32_t b) { cross(a, b); });
+        if (!suppress && onLoopCallbacks.object) for (; wraps > 0; --wraps) dispatch(*onLoopCallbacks.object);
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::cue(uint32_t time, typename detail::tweentraits<T>::callbackType callback) {
+        detail::cue<typename traits::callbackType> c{ time, callback };
+        if (!cues.object) cues.object.reset(new std::vector<detail::cue<typename traits::callbackType>>());
+        auto & list = *cues.object;
+        auto at = std::upper_bound(list.begin(), list.end(), time, [](uint32_t t, const detail::cue<typename traits::callbackType> & c) {
+            return t < c.time;
+        });
+        list.insert(at, std::move(c));
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::cue(uint32_t time, typename detail::tweentraits<T>::noValuesCallbackType callback) {
+        return cue(time, typename traits::callbackType([callback](tween<T> & t, const T &) { return callback(t); }));
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::cue(uint32_t time, typename detail::tweentraits<T>::noTweenCallbackType callback) {
+        return cue(time, typename traits::callbackType([callback](tween<T> &, const T & v) { return callback(v); }));
+    }
+
+    template<typename T>
+    template<typename F>
+    void tween<T>::pass(uint32_t from, uint32_t to, F visit) const {
+        if (from == to) return;
+        auto & list = *cues.object;
+        auto before = [](const detail::cue<typename traits::callbackType> & c, uint32_t t) { return c.time < t; };
+        auto after = [](uint32_t t, const detail::cue<typename traits::callbackType> & c) { return t < c.time; };
+
+        /* Forwards, cues in (from, to] are crossed, and backwards, cues in [to, from) */
+        size_t first, last;
+        if (from < to) {
+            first = std::upper_bound(list.begin(), list.end(), from, after) - list.begin();
+            last = std::upper_bound(list.begin() + first, list.end(), to, after) - list.begin();
+        } else {
+            first = std::lower_bound(list.begin(), list.end(), to, before) - list.begin();
+            last = std::lower_bound(list.begin() + first, list.end(), from, before) - list.begin();
+        }
+        for (size_t k = 0; k < last - first; ++k) visit(from < to ? first + k : last - 1 - k);
+    }
+
+    template<typename T>
+    void tween<T>::cross(uint32_t from, uint32_t to) {
+        auto & list = *cues.object;
+        std::vector<size_t> dismissed;
+        pass(from, to, [this, &list, &dismissed](size_t i) {
+            if (list[i].callback(*this, state->current)) dismissed.push_back(i);
+        });
+        std::sort(dismissed.begin(), dismissed.end());
+        for (size_t i = dismissed.size(); i-- > 0;) list.erase(list.begin() + dismissed[i]);
+    }
+
+    template<typename T>
+    void tween<T>::ring(uint32_t time) {
+        auto & list = *cues.object;
+        auto at = [](const detail::cue<typename traits::callbackType> & c, uint32_t t) { return c.time < t; };
+        size_t i = std::lower_bound(list.begin(), list.end(), time, at) - list.begin();
+        while (i < list.size() && list[i].time == time) {
+            if (list[i].callback(*this, state->current)) list.erase(list.begin() + static_cast<std::ptrdiff_t>(i));
+            else ++i;
+        }
+    }
+
+    template<typename T>
+    template<typename F>
+    void tween<T>::sweep(int64_t from, int64_t to, F cross) const {
+        /* Splits a move over the unfolded timeline of a repeating tween into moves inside each cycle */
+        int64_t length = total;
+        if (from < to) {
+            for (int64_t k = from / length; k * length < to; ++k) {
+                int64_t a = std::max(from, k * length) - k * length;
+                int64_t b = std::min(to, (k + 1) * length) - k * length;
+                if (mirrored && (k & 1)) { a = length - a; b = length - b; }
+                cross(static_cast<uint32_t>(a), static_cast<uint32_t>(b));
+            }
+        } else {
+            for (int64_t k = (from - 1) / length; k >= 0 && (k + 1) * length > to; --k) {
+                int64_t a = std::min(from, (k + 1) * length) - k * length;
+                int64_t b = std::max(to, k * length) - k * length;
+                if (mirrored && (k & 1)) { a = length - a; b = length - b; }
+                cross(static_cast<uint32_t>(a), static_cast<uint32_t>(b));
+            }
+        }
+    }
+
+    template<typename T>
+    inline int64_t tween<T>::unfolded() const {
+        bool reversed = mirrored && (state->cycle & 1u);
+        return int64_t(state->cycle) * total + (reversed ? total - state->progress : state->progress);
+    }
+
     template<typename T>
     inline uint32_t tween<T>::duration() const {
         return total;
@@ -203,14 +400,120 @@ namespace tweeny {
         auto pointDuration = uint32_t(p.duration() - (p.stacked - prog));
         float pointTotal = static_cast<float>(pointDuration) / static_cast<float>(p.duration());
         if (pointTotal > 1.0f) pointTotal = 1.0f;
-        auto easing = std::get<0>(p.easings);
-        value = easing(pointTotal, std::get<0>(p.values), std::get<0>(points.at(point+1).values));
+        value = p.template ease<0>(pointTotal, std::get<0>(p.values), std::get<0>(points.at(point+1).values));
+        if (bumped(point)) value = detail::bump(value, kicks.object->heights, pointTotal);
+    }
+
+    template<typename T>
+    inline void tween<T>::differentiate(uint32_t prog, unsigned point, typename detail::ratetype<T>::type & value) const {
+        auto & p = points.at(point);
+        auto pointDuration = uint32_t(p.duration() - (p.stacked - prog));
+        float duration = static_cast<float>(p.duration());
+        float pointTotal = static_cast<float>(pointDuration) / duration;
+        float rate = duration > 0 ? 1.0f / duration : 0.0f;
+        if (pointTotal > 1.0f) pointTotal = 1.0f;
+        auto slope = p.template slope<0>(pointTotal, std::get<0>(p.values), std::get<0>(points.at(point+1).values));
+        if (bumped(point)) slope = detail::bumpSlope(slope, kicks.object->heights, pointTotal);
+        value = detail::scale(slope, rate);
     }
 
     template<typename T>
     inline void tween<T>::render(uint32_t p) {
-        currentPoint = pointAt(p);
-        interpolate(p, currentPoint, current);
+        state->point = pointAt(p);
+        if (steps.object) difference(p);
+        else interpolate(p, state->point, state->current);
+        present();
+    }
+
+    /* Writes the current value to the bound output and publishes it */
+    template<typename T>
+    inline void tween<T>::present() {
+        if (output) *output = state->current;
+        if (published) snapshots.object->write(state->current);
+    }
+
+    template<typename T>
+    inline void tween<T>::difference(uint32_t p) {
+        auto & s = *steps.object;
+        auto & table = s.tables[0];
+        bool steady = s.follows(p, state->point) && !bumped(state->point);
+        auto & point = points.at(state->point);
+        auto c = std::get<0>(point.curves);
+        if (steady && table.left > 0) {
+            detail::place(state->current, std::get<0>(point.values), std::get<0>(points[state->point + 1].values), table.next());
+            return;
+        }
+        interpolate(p, state->point, state->current);
+        if (std::is_floating_point<T>::value && c && c->shape && s.stride != 0 && !bumped(state->point))
+            table.start(*c->shape, uint32_t(point.duration() - (point.stacked - p)), s.stride, point.duration());
+        else table.left = 0;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::bind(T * t) {
+        output = t;
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::publish(bool enabled) {
+        published = enabled;
+        if (!published) return *this;
+        if (!snapshots.object) snapshots.object.reset(new detail::triplebuffer<T>());
+        snapshots.object->write(state->current);
+        return *this;
+    }
+
+    template<typename T>
+    const T & tween<T>::latest() {
+        if (!snapshots.object) throw std::logic_error("tweeny::tween::latest: the tween never published its values");
+        return snapshots.object->read();
+    }
+
+    template<typename T>
+    typename tween<T>::stateType tween<T>::snapshot() const {
+        return *state;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::restore(const stateType & saved) {
+        *state = saved;
+        present();
+        return *this;
+    }
+
+    template<typename T>
+    detail::awaiter<tween<T>> tween<T>::finished() {
+        return { *this, detail::waiter::finished };
+    }
+
+    template<typename T>
+    detail::awaiter<tween<T>> tween<T>::reaches(uint32_t time) {
+        return { *this, detail::clip(time, 0u, total) };
+    }
+
+    template<typename T>
+    inline void tween<T>::wait(const detail::waiter & w) {
+        if (!waiters.object) waiters.object.reset(new detail::waitlist());
+        auto & list = *waiters.object;
+        list.insert(std::upper_bound(list.begin(), list.end(), w), w);
+    }
+
+    template<typename T>
+    inline void tween<T>::wake(uint32_t from, uint32_t to) {
+        if (from > to) std::swap(from, to);
+        auto & list = *waiters.object;
+        auto first = std::lower_bound(list.begin(), list.end(), detail::waiter{from, nullptr, nullptr, nullptr});
+        auto last = std::upper_bound(first, list.end(), detail::waiter{to, nullptr, nullptr, nullptr});
+        std::vector<detail::waiter> ready(first, last);
+        list.erase(first, last);
+        if (isFinished()) {
+            auto sentinel = std::lower_bound(list.begin(), list.end(), detail::waiter{detail::waiter::finished, nullptr, nullptr, nullptr});
+            ready.insert(ready.end(), sentinel, list.end());
+            list.erase(sentinel, list.end());
+        }
+        /* resumed coroutines may await this tween again, so waiters is updated before resuming any of them */
+        for (auto & w : ready) w.resume(w.handle);
     }
 
     template<typename T>
@@ -221,13 +524,13 @@ namespace tweeny {
 
     template<typename T>
     tween<T> & tween<T>::onStep(typename detail::tweentraits<T>::noValuesCallbackType callback) {
-        onStepCallbacks.push_back([callback](tween<T> & tween, T) { return callback(tween); });
+        onStepCallbacks.push_back([callback](tween<T> & tween, const T &) { return callback(tween); });
         return *this;
     }
 
     template<typename T>
     tween<T> & tween<T>::onStep(typename detail::tweentraits<T>::noTweenCallbackType callback) {
-        onStepCallbacks.push_back([callback](tween<T> &, T v) { return callback(v); });
+        onStepCallbacks.push_back([callback](tween<T> &, const T & v) { return callback(v); });
         return *this;
     }
 
@@ -239,13 +542,13 @@ namespace tweeny {
 
     template<typename T>
     tween<T> & tween<T>::onSeek(typename detail::tweentraits<T>::noValuesCallbackType callback) {
-        onSeekCallbacks.push_back([callback](tween<T> & t, T) { return callback(t); });
+        onSeekCallbacks.push_back([callback](tween<T> & t, const T &) { return callback(t); });
         return *this;
     }
 
     template<typename T>
     tween<T> & tween<T>::onSeek(typename detail::tweentraits<T>::noTweenCallbackType callback) {
-        onSeekCallbacks.push_back([callback](tween<T> &, T v) { return callback(v); });
+        onSeekCallbacks.push_back([callback](tween<T> &, const T & v) { return callback(v); });
         return *this;
     }
 
@@ -254,7 +557,7 @@ namespace tweeny {
         std::vector<size_t> dismissed;
         for (size_t i = 0; i < cbVector.size(); ++i) {
             auto && cb = cbVector[i];
-            bool dismiss = cb(*this, current);
+            bool dismiss = cb(*this, state->current);
             if (dismiss) dismissed.push_back(i);
         }
 
@@ -269,7 +572,7 @@ namespace tweeny {
 
     template<typename T>
     const T & tween<T>::peek() const {
-        return current;
+        return state->current;
     }
 
 
@@ -287,36 +590,68 @@ namespace tweeny {
         return value;
     }
 
+    template<typename T>
+    T tween<T>::peek(float progress, typename detail::ratetype<T>::type & velocity) const {
+        return peek(static_cast<uint32_t>(progress * total), velocity);
+    }
+
+    template<typename T>
+    T tween<T>::peek(uint32_t time, typename detail::ratetype<T>::type & velocity) const {
+        T value;
+        auto point = pointAt(time);
+        interpolate(time, point, value);
+        differentiate(time, point, velocity);
+        return value;
+    }
+
+    template<typename T>
+    typename detail::ratetype<T>::type tween<T>::velocity() const {
+        return peekVelocity(state->progress);
+    }
+
+    template<typename T>
+    typename detail::ratetype<T>::type tween<T>::peekVelocity(float progress) const {
+        return peekVelocity(static_cast<uint32_t>(progress * total));
+    }
+
+    template<typename T>
+    typename detail::ratetype<T>::type tween<T>::peekVelocity(uint32_t time) const {
+        typename detail::ratetype<T>::type velocity;
+        differentiate(time, pointAt(time), velocity);
+        return velocity;
+    }
+
     template<typename T>
     uint32_t tween<T>::currentTimePoint() const {
-        return currentProgress;
+        return state->progress;
     }
 
     template<typename T>
     float tween<T>::progress() const {
-        return static_cast<float>(currentProgress) / static_cast<float>(total);
+        return static_cast<float>(state->progress) / static_cast<float>(total);
     }
 
     template<typename T>
     bool tween<T>::isFinished() const {
-        return currentProgress == total;
+        if (repeats < 0 || state->cycle != static_cast<uint32_t>(repeats)) return false;
+        return (mirrored && (state->cycle & 1u)) ? state->progress == 0 : state->progress == total;
     }
 
     template<typename T>
     tween<T> & tween<T>::forward() {
-        currentDirection = 1;
+        state->direction = 1;
         return *this;
     }
 
     template<typename T>
     tween<T> & tween<T>::backward() {
-        currentDirection = -1;
+        state->direction = -1;
         return *this;
     }
 
     template<typename T>
     int tween<T>::direction() const {
-        return currentDirection;
+        return state->direction;
     }
 
     template<typename T>
@@ -325,8 +660,59 @@ namespace tweeny {
         return seek(points.at(p).stacked, suppress);
     }
 
+    template<typename T>
+    tween<T> & tween<T>::repeat(int32_t count) {
+        repeats = count;
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::yoyo(bool enabled) {
+        mirrored = enabled;
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::rate(float rate) {
+        speed = rate;
+        return *this;
+    }
+
+    template<typename T>
+    float tween<T>::rate() const {
+        return speed;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::fixed(bool enabled) {
+        steps.object.reset(enabled ? new detail::stepping<1>() : nullptr);
+        return *this;
+    }
+
+    template<typename T>
+    uint32_t tween<T>::cycle() const {
+        return state->cycle;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::onLoop(typename detail::tweentraits<T>::callbackType callback) {
+        if (!onLoopCallbacks.object) onLoopCallbacks.object.reset(new std::vector<typename traits::callbackType>());
+        onLoopCallbacks.object->push_back(callback);
+        return *this;
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::onLoop(typename detail::tweentraits<T>::noValuesCallbackType callback) {
+        return onLoop(typename traits::callbackType([callback](tween<T> & t, const T &) { return callback(t); }));
+    }
+
+    template<typename T>
+    tween<T> & tween<T>::onLoop(typename detail::tweentraits<T>::noTweenCallbackType callback) {
+        return onLoop(typename traits::callbackType([callback](tween<T> &, const T & v) { return callback(v); }));
+    }
+
     template<typename T> inline uint16_t tween<T>::point() const {
-        return currentPoint;
+        return state->point;
     }
 
     template<typename T> inline uint16_t tween<T>::pointAt(uint32_t timePoint) const {
@@ -337,5 +723,9 @@ namespace tweeny {
         if (point > 0 && t <= points.at(point - 1u).stacked) point--;
         return point;
     }
+
+    template<typename T> inline bool tween<T>::bumped(unsigned point) const {
+        return kicks.object && kicks.object->point == point;
+    }
 }
 #endif //TWEENY_TWEENONE_TCC
@@ -34,24 +34,48 @@
 
 #include <tuple>
 #include <array>
+#include <memory>
 
 #include "tweentraits.h"
+#include "easingresolve.h"
 
 namespace tweeny {
     namespace detail {
+        /* Owns a heap allocated object that is rarely used, copying it along with its owner */
+        template<typename T>
+        struct cold {
+            std::unique_ptr<T> object;
+
+            cold() = default;
+            cold(const cold & other) : object(other.object ? new T(*other.object) : nullptr) { }
+            cold(cold && other) = default;
+            cold & operator=(const cold & other) { object.reset(other.object ? new T(*other.object) : nullptr); return *this; }
+            cold & operator=(cold && other) = default;
+        };
+
         /*
          * The tweenpoint class aids in the management of a tweening point by the tween class.
          * This class is private.
+         *
+         * Points are kept small, as tweens with many keyframes are bound by memory: bundled easings are referred
+         * to by a pointer to their functions, and user-supplied easings, which need a std::function each, are
+         * only allocated for the points that use them.
          */
         template<typename... Ts>
         struct tweenpoint {
             typedef detail::tweentraits<Ts...> traits;
 
+            /* User-supplied easings and their numerical derivatives */
+            struct custom {
+                typename traits::easingCollection easings;
+                typename traits::velocityCollection velocities;
+            };
+
             typename traits::valuesType values;
             typename traits::durationsArrayType durations;
-            typename traits::easingCollection easings;
-            typename traits::callbackType onEnterCallbacks;
             uint32_t stacked;
+            std::tuple<const curve<Ts> *...> curves; // bundled easing of each value, or nullptr for a custom one
+            cold<custom> customs;
 
             /* Constructs a tweenpoint from a set of values, filling their durations and easings */
             tweenpoint(Ts... vs);
@@ -73,6 +97,15 @@ namespace tweeny {
 
             /* Returns the value of that specific value */
             uint16_t duration(size_t i) const;
+
+            /* Eases the value at index I from this point to the next one */
+            template<size_t I, typename V> V ease(float position, const V & start, const V & end) const;
+
+            /* Returns the derivative of tweenpoint::ease */
+            template<size_t I, typename V> typename ratetype<V>::type slope(float position, const V & start, const V & end) const;
+
+            /* Returns the custom easings, allocating them if needed */
+            custom & callables();
         };
     }
 }
@@ -40,13 +40,13 @@
 
 namespace tweeny {
     namespace detail {
-        template<typename TypeTupleT, typename EasingCollectionT, typename EasingT, size_t I> void easingfill(EasingCollectionT & f, EasingT easing, int2type<I>) {
-            easingresolve<I, TypeTupleT, EasingCollectionT, EasingT>::impl(f, easing);
-            easingfill<TypeTupleT, EasingCollectionT, EasingT>(f, easing, int2type<I - 1>{ });
+        template<typename TypeTupleT, typename PointT, typename EasingT, size_t I> void easingfill(PointT & p, EasingT easing, int2type<I>) {
+            easingresolve<I, TypeTupleT, PointT, EasingT>::impl(p, easing);
+            easingfill<TypeTupleT, PointT, EasingT>(p, easing, int2type<I - 1>{ });
         }
 
-        template<typename TypeTupleT, typename EasingCollectionT, typename EasingT> void easingfill(EasingCollectionT & f, EasingT easing, int2type<0>) {
-            easingresolve<0, TypeTupleT, EasingCollectionT, EasingT>::impl(f, easing);
+        template<typename TypeTupleT, typename PointT, typename EasingT> void easingfill(PointT & p, EasingT easing, int2type<0>) {
+            easingresolve<0, TypeTupleT, PointT, EasingT>::impl(p, easing);
         }
 
 
@@ -67,7 +67,7 @@ namespace tweeny {
 
 
         template<typename... Ts>
-        inline tweenpoint<Ts...>::tweenpoint(Ts... vs) : values{vs...} {
+        inline tweenpoint<Ts...>::tweenpoint(Ts... vs) : values{std::move(vs)...} {
             during(static_cast<uint16_t>(0));
             via(easing::def);
         }
@@ -92,13 +92,13 @@ namespace tweeny {
         inline void tweenpoint<Ts...>::via(Fs... fs) {
             static_assert(sizeof...(Fs) == sizeof...(Ts),
                           "Number of functions passed to via() must be equal the number of values.");
-            detail::easingresolve<0, std::tuple<Ts...>, typename traits::easingCollection, Fs...>::impl(easings, fs...);
+            detail::easingresolve<0, std::tuple<Ts...>, tweenpoint<Ts...>, Fs...>::impl(*this, fs...);
         }
 
         template<typename... Ts>
         template<typename F>
         inline void tweenpoint<Ts...>::via(F f) {
-            easingfill<typename traits::valuesType>(easings, f, int2type<sizeof...(Ts) - 1>{ });
+            easingfill<typename traits::valuesType>(*this, f, int2type<sizeof...(Ts) - 1>{ });
         }
 
         template<typename... Ts>
@@ -110,6 +110,26 @@ namespace tweeny {
         inline uint16_t tweenpoint<Ts...>::duration(size_t i) const {
             return durations.at(i);
         }
+
+        template<typename... Ts>
+        template<size_t I, typename V>
+        inline V tweenpoint<Ts...>::ease(float position, const V & start, const V & end) const {
+            auto c = std::get<I>(curves);
+            return c ? c->run(position, start, end) : std::get<I>(customs.object->easings)(position, start, end);
+        }
+
+        template<typename... Ts>
+        template<size_t I, typename V>
+        inline typename ratetype<V>::type tweenpoint<Ts...>::slope(float position, const V & start, const V & end) const {
+            auto c = std::get<I>(curves);
+            return c ? c->velocity(position, start, end) : std::get<I>(customs.object->velocities)(position, start, end);
+        }
+
+        template<typename... Ts>
+        inline typename tweenpoint<Ts...>::custom & tweenpoint<Ts...>::callables() {
+            if (!customs.object) customs.object.reset(new custom());
+            return *customs.object;
+        }
     }
 }
 #endif //TWEENY_TWEENPOINT_TCC
@@ -36,6 +36,11 @@
 
 namespace tweeny {
     template<typename T, typename... Ts> class tween;
+    template<typename T, typename... Ts> class collection;
+
+    namespace detail {
+        template<typename T, typename... Ts> struct reducer;
+    }
 
     namespace detail {
 
@@ -60,14 +65,24 @@ namespace tweeny {
             typedef std::array<typename first<Ts...>::type, sizeof...(Ts)> type;
         };
 
+        /* The type of the velocity of a value. Integers change by fractions of a unit per millisecond, so their
+         * velocity is a float */
+        template<typename T>
+        struct ratetype {
+            typedef typename std::conditional<std::is_integral<T>::value, float, T>::type type;
+        };
+
         template<typename... Ts>
         struct tweentraits {
-            typedef std::tuple<std::function<Ts(float, Ts, Ts)>...> easingCollection;
-            typedef std::function<bool(tween<Ts...> &, Ts...)> callbackType;
+            typedef std::tuple<std::function<Ts(float, const Ts &, const Ts &)>...> easingCollection;
+            typedef std::tuple<std::function<typename ratetype<Ts>::type(float, const Ts &, const Ts &)>...> velocityCollection;
+            typedef std::function<bool(tween<Ts...> &, const Ts &...)> callbackType;
             typedef std::function<bool(tween<Ts...> &)> noValuesCallbackType;
-            typedef std::function<bool(Ts...)> noTweenCallbackType;
+            typedef std::function<bool(const Ts &...)> noTweenCallbackType;
             typedef typename valuetype<equal<Ts...>::value, Ts...>::type valuesType;
+            typedef typename valuetype<equal<typename ratetype<Ts>::type...>::value, typename ratetype<Ts>::type...>::type velocitiesType;
             typedef std::array<uint16_t, sizeof...(Ts)> durationsArrayType;
+            typedef std::tuple<Ts *...> outputsType;
             typedef tween<Ts...> type;
         };
     }
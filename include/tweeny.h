@@ -79,7 +79,16 @@
 #define TWEENY_H
 
 #include "tween.h"
+#include "collection.h"
+#include "spring.h"
+#include "stream.h"
+#include "reduce.h"
+#include "timescale.h"
+#include "mixer.h"
+#include "pool.h"
+#include "color.h"
 #include "easing.h"
+#include "instantiations.h"
 
 /**
  * @brief The tweeny namespace contains all symbols and names for the Tweeny library.
@@ -33,7 +33,7 @@
 
 namespace tweeny {
   template<typename... Ts> inline tween<Ts...> from(Ts... vs) {
-    return tween<Ts...>::from(vs...);
+    return tween<Ts...>::from(std::move(vs)...);
   }
 }
 
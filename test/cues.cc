@@ -0,0 +1,119 @@
+/*
+ * Checks that cues are called once each time their time point is crossed, in the order they are crossed, whether the
+ * tween steps forwards or backwards, turns around in a yoyo, seeks, jumps or is stepped in a collection that defers
+ * its callbacks.
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "tweeny.h"
+
+namespace {
+    int failed = 0;
+
+    void check(bool passed, const char * what) {
+        if (passed) return;
+        std::printf("%s\n", what);
+        ++failed;
+    }
+
+    /* A tween with cues at 25, 50 and 75 that append their time to a log */
+    tweeny::tween<float> cued(std::vector<int> & log) {
+        auto t = tweeny::from(0.0f).to(100.0f).during(100);
+        for (int time : { 25, 50, 75 }) t.cue(static_cast<uint32_t>(time), [&log, time](float) { log.push_back(time); return false; });
+        return t;
+    }
+
+    /* The same cues on a tween of two values, which has its own implementation */
+    tweeny::tween<float, int> paired(std::vector<int> & log) {
+        auto t = tweeny::from(0.0f, 0).to(100.0f, 100).during(100);
+        for (int time : { 25, 50, 75 }) t.cue(static_cast<uint32_t>(time), [&log, time](float, int) { log.push_back(time); return false; });
+        return t;
+    }
+
+    template<typename TweenT>
+    void stepping(TweenT t, std::vector<int> & log) {
+        t.step(30);
+        check(log == std::vector<int>({ 25 }), "a step forwards did not call the cue it crossed");
+        t.step(20);
+        check(log == std::vector<int>({ 25, 50 }), "a step that reached a cue did not call it");
+        log.clear();
+        t.step(-40);
+        check(log == std::vector<int>({ 25 }), "a step backwards called the cue it started from");
+        log.clear();
+        t.step(-10);
+        t.step(10);
+        check(log.empty(), "a cue was called without being crossed");
+        t.step(100);
+        check(log == std::vector<int>({ 25, 50, 75 }), "a step to the end did not call every cue");
+    }
+
+    template<typename TweenT>
+    void turning(TweenT t, std::vector<int> & log) {
+        t.repeat(1).yoyo();
+        t.step(90);
+        t.step(20);
+        check(log == std::vector<int>({ 25, 50, 75 }), "a step over a yoyo turn called a cue it did not cross");
+        log.clear();
+        t.step(30);
+        check(log == std::vector<int>({ 75 }), "a yoyo cycle did not call the cue after the turn");
+        log.clear();
+        t.step(200);
+        check(log == std::vector<int>({ 50, 25 }), "a yoyo cycle did not call its cues backwards");
+    }
+
+    template<typename TweenT>
+    void seeking(TweenT t, std::vector<int> & log) {
+        t.seek(60u);
+        check(log == std::vector<int>({ 25, 50 }), "seeking did not call the cues it crossed");
+        log.clear();
+        t.seek(0.2f);
+        check(log == std::vector<int>({ 50, 25 }), "seeking backwards did not call its cues in reverse");
+        log.clear();
+        t.seek(10u, true);
+        check(log.empty(), "a suppressed seek called cues");
+        t.jump(0);
+        check(log == std::vector<int>({ 25, 50, 75 }), "jumping to the end of a segment did not call its cues");
+    }
+
+    template<typename TweenT>
+    void each(TweenT (*make)(std::vector<int> &)) {
+        std::vector<int> log;
+        stepping(make(log), log);
+        log.clear();
+        turning(make(log), log);
+        log.clear();
+        seeking(make(log), log);
+    }
+
+    void deferred() {
+        std::vector<int> alone, together;
+        auto t = cued(alone);
+        tweeny::collection<float> c;
+        c.add(cued(together));
+        c.add(cued(together));
+        c.defer();
+        for (int i = 0; i < 10; ++i) {
+            t.step(16);
+            c.step(16);
+            c.flush();
+        }
+        check(alone == std::vector<int>({ 25, 50, 75 }), "a tween did not call its cues in order");
+        check(together == std::vector<int>({ 25, 25, 50, 50, 75, 75 }), "a deferring collection lost cues");
+
+        together.clear();
+        c.seek(10u);
+        c.step(-5);
+        check(together.empty(), "deferred cues were called before the flush");
+        c.flush();
+        check(together == std::vector<int>({ 75, 50, 25, 75, 50, 25 }), "deferred cues were not called when seeking");
+    }
+}
+
+int main() {
+    each(cued);
+    each(paired);
+    deferred();
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Steps tweens with fixed() next to the same tweens stepped normally and checks that they stay within 1e-6 of each
+ * other, relative to the span of the values, through every polynomial easing, backward steps, yoyo and seeks.
+ */
+
+#include <cmath>
+#include <cstdio>
+
+#include "tweeny.h"
+
+namespace {
+    const double bound = 1e-6;
+
+    template<typename EasingT>
+    int single(EasingT easing, const char * name) {
+        int failed = 0;
+        for (int dt : { 1, 3, 16, 17, 33, 250 }) {
+            auto a = tweeny::from(-3.0f).to(250.0f).during(1000).via(easing).to(10.0f).during(777).via(easing)
+                .repeat(3).yoyo();
+            auto b = a;
+            b.fixed();
+            double worst = 0;
+            for (int i = 0; i < 800; ++i) {
+                int d = i % 97 == 0 ? 5 : dt;
+                if (i == 300) { a.backward(); b.backward(); }
+                if (i == 500) { a.seek(900u); b.seek(900u); }
+                worst = std::fmax(worst, std::fabs(a.step(d) - b.step(d)) / 253.0);
+            }
+            if (worst > bound) {
+                std::printf("%s, steps of %d: off by %g\n", name, dt, worst);
+                ++failed;
+            }
+        }
+        return failed;
+    }
+
+    int multiple() {
+        auto a = tweeny::from(0.0f, 0.0, 0, 5.0f).to(100.0f, -50.0, 1000, 8.0f).during(1000, 600, 1000, 400)
+            .via(tweeny::easing::cubicInOut, tweeny::easing::backOut, tweeny::easing::linear, tweeny::easing::sinusoidalIn)
+            .to(0.0f, 10.0, 0, 1.0f).during(500).via(tweeny::easing::quadraticInOut).repeat(2).yoyo();
+        auto b = a;
+        b.fixed();
+        double worst = 0;
+        for (int i = 0; i < 300; ++i) {
+            if (i == 120) { a.backward(); b.backward(); }
+            if (i == 200) { a.seek(300u); b.seek(300u); }
+            auto x = a.step(16);
+            auto y = b.step(16);
+            worst = std::fmax(worst, std::fabs(std::get<0>(x) - std::get<0>(y)) / 100.0);
+            worst = std::fmax(worst, std::fabs(std::get<1>(x) - std::get<1>(y)) / 60.0);
+            worst = std::fmax(worst, std::fabs(std::get<3>(x) - std::get<3>(y)) / 7.0);
+            if (std::get<2>(x) != std::get<2>(y)) worst = 1;
+        }
+        if (worst > bound) std::printf("mixed easings: off by %g\n", worst);
+        return worst > bound ? 1 : 0;
+    }
+}
+
+int main() {
+    using namespace tweeny;
+    int failed = single(easing::linear, "linear")
+        + single(easing::quadraticIn, "quadraticIn") + single(easing::quadraticOut, "quadraticOut")
+        + single(easing::quadraticInOut, "quadraticInOut")
+        + single(easing::cubicIn, "cubicIn") + single(easing::cubicOut, "cubicOut")
+        + single(easing::cubicInOut, "cubicInOut")
+        + single(easing::quarticIn, "quarticIn") + single(easing::quarticOut, "quarticOut")
+        + single(easing::quarticInOut, "quarticInOut")
+        + single(easing::quinticIn, "quinticIn") + single(easing::quinticOut, "quinticOut")
+        + single(easing::quinticInOut, "quinticInOut")
+        + multiple();
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * Steps a published tween and a published collection in one thread while another thread reads their latest values.
+ * Every value of a step is the same, so a reader that sees different values saw a partially written step.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "tweeny.h"
+
+namespace {
+    const int steps = 200000;
+
+    bool same(const std::array<float, 4> & values) {
+        return values[0] == values[1] && values[1] == values[2] && values[2] == values[3];
+    }
+
+    int tween() {
+        auto t = tweeny::from(0.0f, 0.0f, 0.0f, 0.0f).to(1000.0f, 1000.0f, 1000.0f, 1000.0f).during(1000)
+            .repeat(-1).yoyo().publish();
+        std::atomic<bool> done(false);
+        int torn = 0;
+        std::thread reader([&] {
+            while (!done.load()) if (!same(t.latest())) ++torn;
+        });
+        for (int i = 0; i < steps; ++i) t.step(7);
+        done.store(true);
+        reader.join();
+        if (torn > 0) std::printf("tween: %d torn reads\n", torn);
+        return torn;
+    }
+
+    int collection() {
+        tweeny::collection<float, float, float, float> c;
+        for (int i = 0; i < 8; ++i) c.add(tweeny::from(0.0f, 0.0f, 0.0f, 0.0f).to(1000.0f, 1000.0f, 1000.0f, 1000.0f)
+            .during(1000 + i).repeat(-1));
+        c.publish();
+        std::atomic<bool> done(false);
+        int torn = 0;
+        std::thread reader([&] {
+            while (!done.load()) {
+                auto & values = c.latest();
+                if (values.size() != 8) { ++torn; continue; }
+                for (auto & v : values) if (!same(v)) ++torn;
+            }
+        });
+        for (int i = 0; i < steps / 10; ++i) c.step(7);
+        done.store(true);
+        reader.join();
+        if (torn > 0) std::printf("collection: %d torn reads\n", torn);
+        return torn;
+    }
+}
+
+int main() {
+    return tween() + collection() > 0 ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Retargets tweens in the middle of their playback and checks that they keep their repeat count and direction, that
+ * the points after the running one are reached when they would have been, and that a matched velocity only bends the
+ * segment it was matched for.
+ */
+
+#include <cmath>
+#include <cstdio>
+
+#include "tweeny.h"
+
+namespace {
+    int failed = 0;
+
+    void check(bool passed, const char * what) {
+        if (passed) return;
+        std::printf("%s\n", what);
+        ++failed;
+    }
+
+    bool near(float a, float b) {
+        return std::fabs(a - b) < 1e-3f;
+    }
+
+    void repeats() {
+        auto t = tweeny::from(0.0f).to(100.0f).during(100).repeat(3);
+        t.step(250);
+        t.retarget(200.0f, 100);
+        int left = 0;
+        while (!t.isFinished() && left < 1000) { t.step(1); ++left; }
+        check(left == 200, "retargeting gave back the repeat count");
+    }
+
+    void backward() {
+        auto t = tweeny::from(0.0f).to(100.0f).during(100).to(200.0f).during(100);
+        t.step(150);
+        t.backward();
+        t.retarget(300.0f, 100);
+        float before = t.step(0);
+        check(t.step(10) < before, "retargeting made a backward tween play forward");
+    }
+
+    void keyframes() {
+        auto t = tweeny::from(0.0f, 0.0f).to(100.0f, 10.0f).during(100, 40).to(50.0f, 5.0f).during(100);
+        t.step(50);
+        t.retarget(300.0f, 30.0f, 100);
+        auto values = t.step(50);
+        check(near(std::get<0>(values), 100.0f) && near(std::get<1>(values), 10.0f), "a later point moved in time");
+        check(t.duration() == 150, "the running segment did not keep the time left of it");
+        values = t.step(100);
+        check(near(std::get<0>(values), 300.0f) && near(std::get<1>(values), 30.0f), "the new values were not reached");
+    }
+
+    void velocity() {
+        auto t = tweeny::from(0.0f).to(100.0f).during(100).via(tweeny::easing::linear).repeat(1);
+        t.step(50);
+        t.retarget(0.0f, 100, true);
+        check(near(t.velocity(), 1.0f), "the velocity was not matched");
+        t.step(150);
+        check(near(t.velocity(), -0.5f), "the matched velocity outlived its loop");
+
+        auto u = tweeny::from(0.0f).to(100.0f).during(100).via(tweeny::easing::linear);
+        u.step(50);
+        u.retarget(0.0f, 100, true);
+        u.via(tweeny::easing::linear);
+        check(near(u.velocity(), -0.5f), "the matched velocity outlived a change of easing");
+    }
+}
+
+int main() {
+    repeats();
+    backward();
+    keyframes();
+    velocity();
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Checks that restoring a collection snapshot brings every tween back, including tweens that were added, assigned or
+ * copied along with their collection, and that tweens copied out of a collection keep their own state.
+ */
+
+#include <cstdio>
+#include <utility>
+
+#include "tweeny.h"
+
+namespace {
+    int failed = 0;
+
+    void check(bool passed, const char * what) {
+        if (passed) return;
+        std::printf("%s\n", what);
+        ++failed;
+    }
+
+    typedef tweeny::collection<float, int> collection;
+
+    /* Tweens of different durations, so that each one is at a different time point */
+    void fill(collection & c, int count) {
+        for (int i = 0; i < count; ++i) c.add(tweeny::from(0.0f, 0).to(100.0f, 100).during(static_cast<uint32_t>(100 + i)));
+    }
+
+    bool at(const collection & c, uint32_t time) {
+        for (const auto & t : c) if (t.currentTimePoint() != time) return false;
+        return true;
+    }
+
+    void restoring() {
+        collection c;
+        fill(c, 37);
+        c.step(10);
+        collection::stateType saved;
+        c.snapshot(saved);
+        c.step(30);
+        c.restore(saved);
+        check(at(c, 10), "restoring did not bring every tween back");
+        auto alone = tweeny::from(0.0f, 0).to(100.0f, 100).during(105);
+        alone.step(10);
+        check(c[5].peek() == alone.peek(), "restoring did not bring the values back");
+
+        c.add(c[3]); // grows the collection, moving every tween
+        c.step(5);
+        check(at(c, 15), "tweens lost their state when the collection grew");
+        c.snapshot(saved);
+        check(saved.tweens.size() == 38 && saved.tweens[37].progress == 15, "an added tween was not saved");
+
+        c[1] = tweeny::from(5.0f, 5).to(6.0f, 6).during(10);
+        c.step(5);
+        c.snapshot(saved);
+        check(saved.tweens[1].progress == 5, "an assigned tween was not saved");
+    }
+
+    void copying() {
+        collection c;
+        fill(c, 10);
+        c.step(10);
+        collection copy = c;
+        copy.step(10);
+        collection assigned;
+        assigned = copy;
+        assigned.step(10);
+        collection moved = std::move(assigned);
+        moved.step(10);
+        check(at(c, 10) && at(copy, 20) && at(moved, 40), "copies of a collection share their states");
+
+        collection::stateType saved;
+        moved.snapshot(saved);
+        check(saved.tweens[0].progress == 40, "a moved collection saved the states of another one");
+
+        auto lone = c[2];
+        lone.step(50);
+        check(lone.currentTimePoint() == 60 && c[2].currentTimePoint() == 10, "a tween copied out of a collection shares its state");
+    }
+}
+
+int main() {
+    restoring();
+    copying();
+    return failed > 0 ? 1 : 0;
+}